@@ -53,6 +53,8 @@
 #include <liblangutil/CharStream.h>
 #include <liblangutil/Exceptions.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::langutil;
@@ -106,14 +108,24 @@ tuple<int, int> CharStream::translatePositionToLineColumn(int _position) const
 {
 	using size_type = string::size_type;
 	size_type searchPosition = min<size_type>(m_source.size(), _position);
-	int lineNumber = count(m_source.begin(), m_source.begin() + searchPosition, '\n');
-	size_type lineStart;
-	if (searchPosition == 0)
-		lineStart = 0;
-	else
+	vector<size_t> const& starts = lineStarts();
+	auto lineStart = prev(upper_bound(starts.begin(), starts.end(), searchPosition));
+	int lineNumber = lineStart - starts.begin();
+	return tuple<int, int>(lineNumber, searchPosition - *lineStart);
+}
+
+int CharStream::translatePositionToLine(int _position) const
+{
+	return std::get<0>(translatePositionToLineColumn(_position));
+}
+
+vector<size_t> const& CharStream::lineStarts() const
+{
+	if (m_lineStarts.empty())
 	{
-		lineStart = m_source.rfind('\n', searchPosition - 1);
-		lineStart = lineStart == string::npos ? 0 : lineStart + 1;
+		m_lineStarts.push_back(0);
+		for (size_t i = m_source.find('\n'); i != string::npos; i = m_source.find('\n', i + 1))
+			m_lineStarts.push_back(i + 1);
 	}
-	return tuple<int, int>(lineNumber, searchPosition - lineStart);
+	return m_lineStarts;
 }
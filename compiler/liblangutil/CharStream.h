@@ -55,6 +55,7 @@
 #include <cstdint>
 #include <string>
 #include <tuple>
+#include <vector>
 
 namespace solidity::langutil
 {
@@ -68,8 +69,8 @@ class CharStream
 {
 public:
 	CharStream() = default;
-	explicit CharStream(std::string const& _source, std::string const& name):
-		m_source(_source), m_name(name) {}
+	explicit CharStream(std::string _source, std::string name):
+		m_source(std::move(_source)), m_name(std::move(name)) {}
 
 	int position() const { return m_position; }
 	bool isPastEndOfInput(size_t _charsForward = 0) const { return (m_position + _charsForward) >= m_source.size(); }
@@ -94,13 +95,22 @@ public:
 	/// Functions that help pretty-printing parse errors
 	/// Do only use in error cases, they are quite expensive.
 	std::string lineAtPosition(int _position) const;
-	std::tuple<int, int> translatePositionToLineColumn(int _position) const;
 	///@}
 
+	/// @returns zero-based line and column of @a _position.
+	/// The first call indexes the line starts, later calls are O(log n).
+	std::tuple<int, int> translatePositionToLineColumn(int _position) const;
+	/// @returns zero-based line of @a _position, see translatePositionToLineColumn.
+	int translatePositionToLine(int _position) const;
+
 private:
+	std::vector<size_t> const& lineStarts() const;
+
 	std::string m_source;
 	std::string m_name;
 	size_t m_position{0};
+	/// Offsets of the first character of each line, computed on first use
+	mutable std::vector<size_t> m_lineStarts;
 };
 
 }
@@ -260,11 +260,15 @@ Token Scanner::selectToken(char _next, Token _then, Token _else)
 
 bool Scanner::skipWhitespace()
 {
-	int const startPosition = sourcePos();
-	while (isWhiteSpace(m_char))
-		advance();
-	// Return whether or not we skipped any characters.
-	return sourcePos() != startPosition;
+	// m_char is checked first, because a skipped multi-line comment leaves ' ' in it
+	if (!isWhiteSpace(m_char))
+		return false;
+	string const& source = m_source->source();
+	size_t position = sourcePos() + 1;
+	while (position < source.size() && isWhiteSpace(source[position]))
+		++position;
+	m_char = m_source->setPosition(position);
+	return true;
 }
 
 void Scanner::skipWhitespaceExceptUnicodeLinebreak()
@@ -277,8 +281,16 @@ Token Scanner::skipSingleLineComment()
 {
 	// Line terminator is not part of the comment. If it is a
 	// non-ascii line terminator, it will result in a parser error.
-	while (!isUnicodeLinebreak())
-		if (!advance()) break;
+	// Only bytes that can start a line terminator need the full check.
+	string const& source = m_source->source();
+	for (size_t position = sourcePos(); ; ++position)
+	{
+		while (position < source.size() && !isLinebreakStart(source[position]))
+			++position;
+		m_char = m_source->setPosition(position);
+		if (isSourcePastEndOfInput() || isUnicodeLinebreak())
+			break;
+	}
 
 	return Token::Whitespace;
 }
@@ -344,21 +356,18 @@ Token Scanner::scanSingleLineDocComment()
 Token Scanner::skipMultiLineComment()
 {
 	advance();
-	while (!isSourcePastEndOfInput())
+	size_t const end = m_source->source().find("*/", sourcePos());
+	if (end != string::npos)
 	{
-		char ch = m_char;
-		advance();
-
 		// If we have reached the end of the multi-line comment, we
 		// consume the '/' and insert a whitespace. This way all
 		// multi-line comments are treated as whitespace.
-		if (ch == '*' && m_char == '/')
-		{
-			m_char = ' ';
-			return Token::Whitespace;
-		}
+		m_source->setPosition(end + 1);
+		m_char = ' ';
+		return Token::Whitespace;
 	}
 	// Unterminated multi-line comment.
+	m_char = m_source->setPosition(m_source->source().size());
 	return setError(ScannerError::IllegalCommentTerminator);
 }
 
@@ -739,6 +748,12 @@ bool Scanner::scanEscape()
 	return true;
 }
 
+bool Scanner::isLinebreakStart(char _c)
+{
+	// ASCII line terminators and the first bytes of NEL, LS and PS in utf8
+	return (0x0a <= _c && _c <= 0x0d) || uint8_t(_c) == 0xc2 || uint8_t(_c) == 0xe2;
+}
+
 bool Scanner::isUnicodeLinebreak()
 {
 	if (0x0a <= m_char && m_char <= 0x0d)
@@ -762,8 +777,21 @@ Token Scanner::scanString()
 	char const quote = m_char;
 	advance();  // consume quote
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
+	string const& source = m_source->source();
 	while (m_char != quote && !isSourcePastEndOfInput() && !isUnicodeLinebreak())
 	{
+		// copy a run of characters without escapes and line terminators at once
+		size_t const start = sourcePos();
+		size_t end = start;
+		while (end < source.size() && source[end] != quote && source[end] != '\\' && !isLinebreakStart(source[end]))
+			++end;
+		if (end != start)
+		{
+			m_tokens[NextNext].literal.append(source, start, end - start);
+			m_char = m_source->setPosition(end);
+			continue;
+		}
+
 		char c = m_char;
 		advance();
 		if (c == '\\')
@@ -928,10 +956,14 @@ tuple<Token, unsigned, unsigned> Scanner::scanIdentifierOrKeyword()
 {
 	solAssert(isIdentifierStart(m_char), "");
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
-	addLiteralCharAndAdvance();
-	// Scan the rest of the identifier characters.
-	while (isIdentifierPart(m_char) || (m_char == '.' && m_supportPeriodInIdentifier))
-		addLiteralCharAndAdvance();
+	// Scan the rest of the identifier characters and copy the literal at once.
+	string const& source = m_source->source();
+	size_t const start = sourcePos();
+	size_t end = start + 1;
+	while (end < source.size() && (isIdentifierPart(source[end]) || (source[end] == '.' && m_supportPeriodInIdentifier)))
+		++end;
+	m_tokens[NextNext].literal.assign(source, start, end - start);
+	m_char = m_source->setPosition(end);
 	literal.complete();
 	return TokenTraits::fromIdentifierOrKeyword(m_tokens[NextNext].literal);
 }
@@ -241,6 +241,7 @@ private:
 
 	/// @returns true iff we are currently positioned at a unicode line break.
 	bool isUnicodeLinebreak();
+	static bool isLinebreakStart(char _c);
 
 	/// Return the current source position.
 	int sourcePos() const { return m_source->position(); }
@@ -42,7 +42,7 @@
 
 #include <liblangutil/Token.h>
 #include <boost/range/iterator_range.hpp>
-#include <map>
+#include <unordered_map>
 
 using namespace std;
 
@@ -145,7 +145,7 @@ static Token keywordByName(string const& _name)
 	// and keywords to be put inside the keywords variable.
 #define KEYWORD(name, string, precedence) {string, Token::name},
 #define TOKEN(name, string, precedence)
-	static map<string, Token> const keywords({TOKEN_LIST(TOKEN, KEYWORD)});
+	static unordered_map<string, Token> const keywords({TOKEN_LIST(TOKEN, KEYWORD)});
 #undef KEYWORD
 #undef TOKEN
 	auto it = keywords.find(_name);
@@ -39,10 +39,10 @@ Declaration const* DeclarationContainer::conflictingDeclaration(
 		_name = &_declaration.name();
 	solAssert(!_name->empty(), "");
 	vector<Declaration const*> declarations;
-	if (m_declarations.count(*_name))
-		declarations += m_declarations.at(*_name);
-	if (m_invisibleDeclarations.count(*_name))
-		declarations += m_invisibleDeclarations.at(*_name);
+	if (auto visible = m_declarations.find(*_name))
+		declarations += *visible;
+	if (auto invisible = m_invisibleDeclarations.find(*_name))
+		declarations += *invisible;
 
 	if (
 		dynamic_cast<FunctionDefinition const*>(&_declaration) ||
@@ -82,18 +82,20 @@ Declaration const* DeclarationContainer::conflictingDeclaration(
 
 void DeclarationContainer::activateVariable(ASTString const& _name)
 {
+	auto invisible = m_invisibleDeclarations.find(_name);
 	solAssert(
-		m_invisibleDeclarations.count(_name) && m_invisibleDeclarations.at(_name).size() == 1,
+		invisible && invisible->size() == 1,
 		"Tried to activate a non-inactive variable or multiple inactive variables with the same name."
 	);
-	solAssert(m_declarations.count(_name) == 0 || m_declarations.at(_name).empty(), "");
-	m_declarations[_name].emplace_back(m_invisibleDeclarations.at(_name).front());
+	auto visible = m_declarations.find(_name);
+	solAssert(!visible || visible->empty(), "");
+	m_declarations[_name].emplace_back(invisible->front());
 	m_invisibleDeclarations.erase(_name);
 }
 
 bool DeclarationContainer::isInvisible(ASTString const& _name) const
 {
-	return m_invisibleDeclarations.count(_name);
+	return m_invisibleDeclarations.find(_name) != nullptr;
 }
 
 bool DeclarationContainer::registerDeclaration(
@@ -127,10 +129,11 @@ vector<Declaration const*> DeclarationContainer::resolveName(ASTString const& _n
 {
 	solAssert(!_name.empty(), "Attempt to resolve empty name.");
 	vector<Declaration const*> result;
-	if (m_declarations.count(_name))
-		result = m_declarations.at(_name);
-	if (_alsoInvisible && m_invisibleDeclarations.count(_name))
-		result += m_invisibleDeclarations.at(_name);
+	if (auto visible = m_declarations.find(_name))
+		result = *visible;
+	if (_alsoInvisible)
+		if (auto invisible = m_invisibleDeclarations.find(_name))
+			result += *invisible;
 	if (result.empty() && _recursive && m_enclosingContainer)
 		result = m_enclosingContainer->resolveName(_name, true, _alsoInvisible);
 	return result;
@@ -145,13 +148,13 @@ vector<ASTString> DeclarationContainer::similarNames(ASTString const& _name) con
 
 	vector<ASTString> similar;
 	size_t maximumEditDistance = _name.size() > 3 ? 2 : _name.size() / 2;
-	for (auto const& declaration: m_declarations)
+	for (auto const& declaration: m_declarations.ordered())
 	{
 		string const& declarationName = declaration.first;
 		if (util::stringWithinDistance(_name, declarationName, maximumEditDistance, MAXIMUM_LENGTH_THRESHOLD))
 			similar.push_back(declarationName);
 	}
-	for (auto const& declaration: m_invisibleDeclarations)
+	for (auto const& declaration: m_invisibleDeclarations.ordered())
 	{
 		string const& declarationName = declaration.first;
 		if (util::stringWithinDistance(_name, declarationName, maximumEditDistance, MAXIMUM_LENGTH_THRESHOLD))
@@ -163,3 +166,28 @@ vector<ASTString> DeclarationContainer::similarNames(ASTString const& _name) con
 
 	return similar;
 }
+
+vector<Declaration const*> const* DeclarationContainer::NameMap::find(ASTString const& _name) const
+{
+	auto it = m_index.find(_name);
+	return it == m_index.end() ? nullptr : it->second;
+}
+
+vector<Declaration const*>& DeclarationContainer::NameMap::operator[](ASTString const& _name)
+{
+	auto it = m_index.find(_name);
+	if (it != m_index.end())
+		return *it->second;
+	auto inserted = m_ordered.emplace(_name, vector<Declaration const*>{}).first;
+	m_index.emplace(inserted->first, &inserted->second);
+	return inserted->second;
+}
+
+void DeclarationContainer::NameMap::erase(ASTString const& _name)
+{
+	auto it = m_ordered.find(_name);
+	if (it == m_ordered.end())
+		return;
+	m_index.erase(it->first);
+	m_ordered.erase(it);
+}
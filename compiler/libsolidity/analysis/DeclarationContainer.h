@@ -26,6 +26,8 @@
 #include <boost/noncopyable.hpp>
 #include <map>
 #include <set>
+#include <string_view>
+#include <unordered_map>
 
 namespace solidity::frontend
 {
@@ -51,7 +53,7 @@ public:
 	std::vector<Declaration const*> resolveName(ASTString const& _name, bool _recursive = false, bool _alsoInvisible = false) const;
 	ASTNode const* enclosingNode() const { return m_enclosingNode; }
 	DeclarationContainer const* enclosingContainer() const { return m_enclosingContainer; }
-	std::map<ASTString, std::vector<Declaration const*>> const& declarations() const { return m_declarations; }
+	std::map<ASTString, std::vector<Declaration const*>> const& declarations() const { return m_declarations.ordered(); }
 	/// @returns whether declaration is valid, and if not also returns previous declaration.
 	Declaration const* conflictingDeclaration(Declaration const& _declaration, ASTString const* _name = nullptr) const;
 
@@ -67,10 +69,30 @@ public:
 	std::vector<ASTString> similarNames(ASTString const& _name) const;
 
 private:
+	/// Declarations by name. The ordered map keeps iteration deterministic, the hash index
+	/// over its keys makes lookups a single hash instead of string comparisons down the tree.
+	class NameMap
+	{
+	public:
+		NameMap() = default;
+		NameMap(NameMap const&) = delete;
+		NameMap& operator=(NameMap const&) = delete;
+
+		std::vector<Declaration const*> const* find(ASTString const& _name) const;
+		std::vector<Declaration const*>& operator[](ASTString const& _name);
+		void erase(ASTString const& _name);
+		std::map<ASTString, std::vector<Declaration const*>> const& ordered() const { return m_ordered; }
+
+	private:
+		std::map<ASTString, std::vector<Declaration const*>> m_ordered;
+		/// Keys view the strings owned by m_ordered, whose nodes never move
+		std::unordered_map<std::string_view, std::vector<Declaration const*>*> m_index;
+	};
+
 	ASTNode const* m_enclosingNode;
 	DeclarationContainer const* m_enclosingContainer;
-	std::map<ASTString, std::vector<Declaration const*>> m_declarations;
-	std::map<ASTString, std::vector<Declaration const*>> m_invisibleDeclarations;
+	NameMap m_declarations;
+	NameMap m_invisibleDeclarations;
 };
 
 }
@@ -147,6 +147,11 @@ bool SyntaxChecker::visit(PragmaDirective const& _pragma)
 	{
 		return true;
 	}
+	else if (_pragma.literals()[0] == "optimizeStorage")
+	{
+		if (_pragma.literals().size() != 1)
+			m_errorReporter.syntaxError(_pragma.location(), "Correct format: pragma optimizeStorage");
+	}
 	else if (_pragma.literals()[0] == "msgValue")
 	{
 		if (m_msgValuePragmaFound) {
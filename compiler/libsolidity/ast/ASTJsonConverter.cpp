@@ -27,6 +27,7 @@
 #include <libsolutil/UTF8.h>
 
 #include <boost/algorithm/string/join.hpp>
+#include <boost/algorithm/string/replace.hpp>
 #include <boost/range/algorithm/sort.hpp>
 
 #include <vector>
@@ -38,6 +39,41 @@ using namespace solidity::langutil;
 namespace solidity::frontend
 {
 
+namespace
+{
+
+/// Member of the marker objects that stand for deferred nodes. The "name" member lets
+/// markers pass for nodes in the legacy format.
+string const deferredNodeKey = "@deferredNode";
+
+bool isDeferredNode(Json::Value const& _value)
+{
+	return _value.isObject() && _value.isMember(deferredNodeKey);
+}
+
+/// @returns true if @a _value is an array with deferred nodes or a node with such an array.
+bool hasDeferredNodes(Json::Value const& _value)
+{
+	if (_value.isArray())
+	{
+		for (auto const& element: _value)
+			if (isDeferredNode(element))
+				return true;
+	}
+	else if (_value.isObject())
+		for (auto const& member: _value)
+			if (member.isArray() && hasDeferredNodes(member))
+				return true;
+	return false;
+}
+
+string prettyPrint(Json::Value const& _value, string const& _indent)
+{
+	return boost::replace_all_copy(util::jsonPrettyPrint(_value), "\n", "\n" + _indent);
+}
+
+}
+
 ASTJsonConverter::ASTJsonConverter(bool _legacy, map<string, unsigned> _sourceIndices):
 	m_legacy(_legacy),
 	m_sourceIndices(_sourceIndices)
@@ -184,7 +220,66 @@ void ASTJsonConverter::appendExpressionAttributes(
 
 void ASTJsonConverter::print(ostream& _stream, ASTNode const& _node)
 {
-	_stream << util::jsonPrettyPrint(toJson(_node));
+	m_deferNodes = true;
+	Json::Value json = toJson(_node);
+	write(_stream, json, "");
+	m_deferNodes = false;
+	m_deferredNodes.clear();
+}
+
+Json::Value ASTJsonConverter::deferNode(ASTNode const& _node)
+{
+	Json::Value marker(Json::objectValue);
+	marker["name"] = Json::nullValue;
+	marker[deferredNodeKey] = Json::UInt64(m_deferredNodes.size());
+	m_deferredNodes.push_back(&_node);
+	return marker;
+}
+
+void ASTJsonConverter::write(ostream& _stream, Json::Value const& _value, string const& _indent)
+{
+	// Mirrors the layout of the jsoncpp writer: non-empty objects and multi-line arrays
+	// start on a new line after a member name, every element on its own line.
+	string const innerIndent = _indent + "  ";
+	if (isDeferredNode(_value))
+	{
+		Json::Value json = toJson(*m_deferredNodes.at(_value[deferredNodeKey].asUInt64()));
+		write(_stream, json, _indent);
+	}
+	else if (!hasDeferredNodes(_value))
+		_stream << prettyPrint(_value, _indent);
+	else if (_value.isArray())
+	{
+		_stream << "[";
+		for (Json::ArrayIndex i = 0; i < _value.size(); ++i)
+		{
+			_stream << (i == 0 ? "\n" : ",\n") << innerIndent;
+			write(_stream, _value[i], innerIndent);
+		}
+		_stream << "\n" << _indent << "]";
+	}
+	else
+	{
+		_stream << "{";
+		bool first = true;
+		for (string const& name: _value.getMemberNames())
+		{
+			Json::Value const& member = _value[name];
+			_stream << (first ? "\n" : ",\n") << innerIndent << util::jsonPrettyPrint(name) << ":";
+			first = false;
+			if (isDeferredNode(member) || hasDeferredNodes(member))
+			{
+				_stream << "\n" << innerIndent;
+				write(_stream, member, innerIndent);
+			}
+			else
+			{
+				string text = prettyPrint(member, innerIndent);
+				_stream << (text.find('\n') == string::npos ? " " : "\n" + innerIndent) << text;
+			}
+		}
+		_stream << "\n" << _indent << "}";
+	}
 }
 
 Json::Value&& ASTJsonConverter::toJson(ASTNode const& _node)
@@ -208,7 +303,7 @@ bool ASTJsonConverter::visit(SourceUnit const& _node)
 		{
 			make_pair("absolutePath", _node.annotation().path),
 			make_pair("exportedSymbols", move(exportedSymbols)),
-			make_pair("nodes", toJson(_node.nodes()))
+			make_pair("nodes", toJsonOrDeferred(_node.nodes()))
 		}
 	);
 	return false;
@@ -259,7 +354,7 @@ bool ASTJsonConverter::visit(ContractDefinition const& _node)
 		make_pair("linearizedBaseContracts", getContainerIds(_node.annotation().linearizedBaseContracts)),
 		make_pair("baseContracts", toJson(_node.baseContracts())),
 		make_pair("contractDependencies", getContainerIds(_node.annotation().contractDependencies, true)),
-		make_pair("nodes", toJson(_node.subNodes())),
+		make_pair("nodes", toJsonOrDeferred(_node.subNodes())),
 		make_pair("scope", idOrNull(_node.scope()))
 	});
 	return false;
@@ -56,6 +56,8 @@ public:
 		std::map<std::string, unsigned> _sourceIndices = std::map<std::string, unsigned>()
 	);
 	/// Output the json representation of the AST to _stream.
+	/// The members of source units and contracts are converted and written one after another,
+	/// so the JSON of the whole AST is never held in memory.
 	void print(std::ostream& _stream, ASTNode const& _node);
 	Json::Value&& toJson(ASTNode const& _node);
 	template <class T>
@@ -69,6 +71,21 @@ public:
 				ret.append(Json::nullValue);
 		return ret;
 	}
+	/// Like toJson, but while printing only places markers for @a _nodes that are
+	/// converted when they are written.
+	template <class T>
+	Json::Value toJsonOrDeferred(std::vector<ASTPointer<T>> const& _nodes)
+	{
+		if (!m_deferNodes)
+			return toJson(_nodes);
+		Json::Value ret(Json::arrayValue);
+		for (auto const& n: _nodes)
+			if (n)
+				appendMove(ret, deferNode(*n));
+			else
+				ret.append(Json::nullValue);
+		return ret;
+	}
 	bool visit(SourceUnit const& _node) override;
 	bool visit(PragmaDirective const& _node) override;
 	bool visit(ImportDirective const& _node) override;
@@ -144,6 +161,10 @@ private:
 		std::string const& _nodeName,
 		std::vector<std::pair<std::string, Json::Value>>&& _attributes
 	);
+	Json::Value deferNode(ASTNode const& _node);
+	/// Writes @a _value formatted like util::jsonPrettyPrint, with every line after the first
+	/// indented by @a _indent, and converts the deferred nodes on the way.
+	void write(std::ostream& _stream, Json::Value const& _value, std::string const& _indent);
 	size_t sourceIndexFromLocation(langutil::SourceLocation const& _location) const;
 	std::string sourceLocationToString(langutil::SourceLocation const& _location) const;
 	static std::string namePathToString(std::vector<ASTString> const& _namePath);
@@ -197,6 +218,8 @@ private:
 
 	bool m_legacy = false; ///< if true, use legacy format
 	bool m_inEvent = false; ///< whether we are currently inside an event or not
+	bool m_deferNodes = false; ///< whether toJsonOrDeferred only places markers
+	std::vector<ASTNode const*> m_deferredNodes; ///< nodes referenced by the markers
 	Json::Value m_currentValue;
 	std::map<std::string, unsigned> m_sourceIndices;
 };
@@ -25,6 +25,7 @@ using namespace solidity::frontend;
 solidity::langutil::ErrorReporter* GlobalParams::g_errorReporter{};
 bool GlobalParams::g_withOptimizations{};
 bool GlobalParams::g_withDebugInfo{};
+std::string GlobalParams::g_optimizerCacheFolder;
 
 void TVMCompilerProceedContract(
     solidity::langutil::ErrorReporter* errorReporter,
@@ -37,11 +38,13 @@ void TVMCompilerProceedContract(
 	const std::string& solFileName,
 	const std::string& outputFolder,
 	const std::string& filePrefix,
+	const std::string& optimizerCacheFolder,
 	bool doPrintFunctionIds
 ) {
     GlobalParams::g_errorReporter = errorReporter;
     GlobalParams::g_withDebugInfo = withDebugInfo;
     GlobalParams::g_withOptimizations = withOptimizations;
+    GlobalParams::g_optimizerCacheFolder = optimizerCacheFolder;
 
 	std::string pathToFiles;
 
@@ -68,12 +71,24 @@ void TVMCompilerProceedContract(
 		pathToFiles = (fs::path(dir) / pathToFiles).string();
     }
 
+	if (!optimizerCacheFolder.empty()) {
+		boost::system::error_code ec;
+		boost::filesystem::create_directories(optimizerCacheFolder, ec);
+		if (ec) {
+			errorReporter->fatalTypeError(_contract.location(), "Problem with directory \"" + optimizerCacheFolder + "\": " + ec.message());
+			return;
+		}
+	}
+
 	PragmaDirectiveHelper pragmaHelper{*pragmaDirectives};
 	if (doPrintFunctionIds) {
 		TVMContractCompiler::printFunctionIds(_contract, pragmaHelper);
 	} else {
 		if (generateCode) {
 			TVMContractCompiler::proceedContract(pathToFiles + ".code", _contract, pragmaHelper);
+			if (pragmaHelper.haveOptimizeStorage()) {
+				TVMContractCompiler::generateStorageLayout(pathToFiles + ".layout.json", _contract, pragmaHelper);
+			}
 		}
 		if (generateAbi) {
 			TVMContractCompiler::generateABI(pathToFiles + ".abi.json", &_contract, *pragmaDirectives);
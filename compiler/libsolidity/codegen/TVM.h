@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <string>
 #include <vector>
 #include <liblangutil/ErrorReporter.h>
 #include <libsolidity/ast/ASTForward.h>
@@ -27,6 +28,7 @@ public:
     static solidity::langutil::ErrorReporter* g_errorReporter;
     static bool g_withOptimizations;
     static bool g_withDebugInfo;
+    static std::string g_optimizerCacheFolder;
 };
 
 void TVMCompilerProceedContract(
@@ -40,5 +42,6 @@ void TVMCompilerProceedContract(
 	const std::string& solFileName,
 	const std::string& outputFolder,
 	const std::string& filePrefix,
+	const std::string& optimizerCacheFolder,
 	bool doPrintFunctionIds
 );
\ No newline at end of file
@@ -572,6 +572,9 @@ void ChainDataDecoder::decodePublicFunctionParameters(const std::vector<Type con
 			position = std::make_unique<DecodePositionAbiV1>();
 			break;
 		case 2: {
+			if (tryDecodeFixedLayout(types, isResponsible)) {
+				return;
+			}
 			position = std::make_unique<DecodePositionAbiV2>(minBits(isResponsible), maxBits(isResponsible), types, false);
 			break;
 		}
@@ -581,6 +584,77 @@ void ChainDataDecoder::decodePublicFunctionParameters(const std::vector<Type con
 	decodeParameters(types, *position, true);
 }
 
+bool ChainDataDecoder::tryDecodeFixedLayout(const std::vector<Type const*>& types, bool isResponsible) {
+	// The header size is not known at compile time, so the checked decoder tests for the end of cell
+	// before some parameters. If all parameters have fixed size, the sender stores them in one cell
+	// iff the slice contains exactly their bits and refs. Check it once and load the parameters without tests.
+	std::vector<Type const*> flatTypes;
+	std::function<void(Type const*)> flatten = [&](Type const* type) {
+		if (auto structType = to<StructType>(type)) {
+			for (const ASTPointer<VariableDeclaration>& m : structType->structDefinition().members()) {
+				flatten(m->type());
+			}
+		} else {
+			flatTypes.push_back(type);
+		}
+	};
+	for (Type const* type : types) {
+		flatten(type);
+	}
+
+	int bits = 0;
+	int refs = 0;
+	for (Type const* type : flatTypes) {
+		ABITypeSize size{type};
+		if (size.minBits != size.maxBits || size.minRefs != size.maxRefs) {
+			return false;
+		}
+		bits += size.maxBits;
+		refs += size.maxRefs;
+	}
+	// with 4 refs the sender can move the last ref to the next cell without changing the counters
+	if (bits > TvmConst::CellBitLength || refs > 3) {
+		return false;
+	}
+
+	DecodePositionAbiV2 checkedPosition{minBits(isResponsible), maxBits(isResponsible), types, false};
+	bool hasChecks = false;
+	for (Type const* type : flatTypes) {
+		hasChecks |= checkedPosition.updateStateAndGetLoadAlgo(type) != DecodePosition::JustLoad;
+	}
+	if (!hasChecks) {
+		return false;
+	}
+
+	const int paramQty = types.size();
+	// stack: slice
+	pusher->pushS(0);
+	pusher->push(-1 + 2, "SBITREFS");
+	pusher->push(-1 + 1, "EQINT " + toString(refs));
+	pusher->exchange(0, 1);
+	pusher->pushInt(bits);
+	pusher->push(-2 + 1, "EQUAL");
+	pusher->push(-2 + 1, "AND");
+	// stack: slice isOneCell
+	pusher->push(-1, "");
+	const int ss = pusher->getStack().size();
+
+	pusher->startContinuation();
+	DecodePositionFromOneSlice fastPosition;
+	decodeParameters(types, fastPosition, true);
+	pusher->endContinuation(-paramQty + 1);
+	pusher->getStack().ensureSize(ss);
+
+	pusher->startContinuation();
+	DecodePositionAbiV2 position{minBits(isResponsible), maxBits(isResponsible), types, false};
+	decodeParameters(types, position, true);
+	pusher->endContinuation();
+	pusher->getStack().ensureSize(ss + paramQty - 1);
+
+	pusher->push(0, "IFELSE");
+	return true;
+}
+
 void ChainDataDecoder::decodeData(const std::vector<Type const*>& types, int offset, bool _fastLoad) {
 	fastLoad = _fastLoad;
 	std::unique_ptr<DecodePosition> position;
@@ -821,6 +895,22 @@ int EncodePosition::countOfCreatedBuilders() const {
 	return qtyOfCreatedBuilders;
 }
 
+int EncodePosition::maxBits() const {
+	int bits = 0;
+	for (Type const* t : types) {
+		bits += ABITypeSize(t).maxBits;
+	}
+	return bits;
+}
+
+int EncodePosition::maxRefs() const {
+	int refs = 0;
+	for (Type const* t : types) {
+		refs += ABITypeSize(t).maxRefs;
+	}
+	return refs;
+}
+
 void ChainDataEncoder::createDefaultConstructorMsgBodyAndAppendToBuilder(const int bitSizeBuilder)
 {
 	uint32_t funcID = calculateConstructorFunctionID();
@@ -1006,24 +1096,71 @@ void ChainDataEncoder::createMsgBodyAndAppendToBuilder(
 
 	std::vector<Type const*> types = getParams(params).first;
 	const int callbackLength = callbackFunctionId.has_value() ? 32 : 0;
-	std::unique_ptr<EncodePosition> position = std::make_unique<EncodePosition>(bitSizeBuilder + 32 + callbackLength, types);
-	const bool doAppend = position->countOfCreatedBuilders() == 0;
-	doAppend ? pusher->stzeroes(1) : pusher->stones(1);
+	EncodePosition position{bitSizeBuilder + 32 + callbackLength, types};
 	if (params.size() >= 2 && !reversedArgs) {
 		pusher->reverse(params.size(), 1);
 	}
-	if (!doAppend) {
-		position = std::make_unique<EncodePosition>(32 + callbackLength, types);
-		pusher->blockSwap(params.size(), 1); // msgBuilder, arg[n-1], ..., arg[1], arg[0]
-		pusher->push(+1, "NEWC"); // msgBuilder, arg[n-1], ..., arg[1], arg[0], builder
-	}
-
 	// arg[n-1], ..., arg[1], arg[0], msgBuilder
-	createMsgBody(params, functionId, callbackFunctionId, *position);
 
-	if (!doAppend) {
+	const int paramQty = params.size();
+	auto appendBody = [&](int headerBitSize) {
+		pusher->stzeroes(1);
+		EncodePosition inlinePosition{headerBitSize + 32 + callbackLength, types};
+		createMsgBody(params, functionId, callbackFunctionId, inlinePosition);
+	};
+	auto appendBodyInRef = [&]() {
+		pusher->stones(1);
+		EncodePosition refPosition{32 + callbackLength, types};
+		pusher->blockSwap(params.size(), 1); // msgBuilder, arg[n-1], ..., arg[1], arg[0]
+		pusher->push(+1, "NEWC"); // msgBuilder, arg[n-1], ..., arg[1], arg[0], builder
+		createMsgBody(params, functionId, callbackFunctionId, refPosition);
 		// msgBuilder, builder
 		pusher->push(-1, "STBREFR");
+	};
+
+	if (position.countOfCreatedBuilders() == 0) {
+		appendBody(bitSizeBuilder);
+	} else {
+		// bitSizeBuilder is the worst case of the message header (e.g. addr_var destination, 16-byte value).
+		// If the body fits in one cell, check the real free space of the builder at runtime and
+		// avoid creating a cell for the body when the header is shorter.
+		EncodePosition oneCellPosition{32 + callbackLength, types};
+		if (oneCellPosition.countOfCreatedBuilders() == 0) {
+			const int needBits = 1 + 32 + callbackLength + oneCellPosition.maxBits();
+			const int needRefs = oneCellPosition.maxRefs();
+			// arg[n-1], ..., arg[1], arg[0], msgBuilder
+			pusher->pushS(0);
+			if (needRefs == 0) {
+				pusher->push(-1 + 1, "BREMBITS");
+				pusher->pushInt(needBits);
+				pusher->push(-2 + 1, "GEQ");
+			} else {
+				pusher->push(-1 + 2, "BREMBITREFS");
+				pusher->pushInt(needRefs);
+				pusher->push(-2 + 1, "GEQ");
+				pusher->exchange(0, 1);
+				pusher->pushInt(needBits);
+				pusher->push(-2 + 1, "GEQ");
+				pusher->push(-2 + 1, "AND");
+			}
+			// arg[n-1], ..., arg[1], arg[0], msgBuilder isEnoughSpace
+			pusher->push(-1, "");
+			const int ss = pusher->getStack().size();
+
+			pusher->startContinuation();
+			appendBody(0);
+			pusher->endContinuation(+paramQty);
+			pusher->getStack().ensureSize(ss);
+
+			pusher->startContinuation();
+			appendBodyInRef();
+			pusher->endContinuation();
+			pusher->getStack().ensureSize(ss - paramQty);
+
+			pusher->push(0, "IFELSE");
+		} else {
+			appendBodyInRef();
+		}
 	}
 
 	solAssert(saveStackSize == int(pusher->getStack().size() + params.size()), "");
@@ -130,6 +130,7 @@ private:
 	void loadNextSliceIfNeed(const DecodePosition::Algo algo, bool isRefType);
 	void loadq(const DecodePosition::Algo algo, const std::string& opcodeq, const std::string& opcode);
 	void decodeParameter(Type const* type, DecodePosition* position);
+	bool tryDecodeFixedLayout(const std::vector<Type const*>& types, bool isResponsible);
 private:
 	StackPusherHelper *pusher{};
 	bool fastLoad{};
@@ -161,6 +162,8 @@ private:
 	void init(Type const* t);
 public:
 	int countOfCreatedBuilders() const;
+	int maxBits() const;
+	int maxRefs() const;
 };
 
 class ChainDataEncoder : private boost::noncopyable {
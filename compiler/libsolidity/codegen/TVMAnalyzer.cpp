@@ -261,6 +261,251 @@ bool isFunctionOfFirstType(const FunctionDefinition *f) {
 	return !f->modifiers().empty();
 }
 
+BytesCursorScanner::BytesCursorScanner(ForStatement const& _forStatement) :
+	m_loopVar{findLoopVar(_forStatement)}
+{
+	if (m_loopVar == nullptr) {
+		return;
+	}
+	if (_forStatement.condition()) {
+		_forStatement.condition()->accept(*this);
+	}
+	_forStatement.body().accept(*this);
+}
+
+std::map<VariableDeclaration const*, std::vector<IndexAccess const*>> BytesCursorScanner::cursors() const {
+	std::map<VariableDeclaration const*, std::vector<IndexAccess const*>> res;
+	if (m_loopVar == nullptr || m_changed.count(m_loopVar)) {
+		return res;
+	}
+	for (const auto& [bytes, reads] : m_reads) {
+		if (!m_changed.count(bytes)) {
+			res.emplace(bytes, reads);
+		}
+	}
+	return res;
+}
+
+bool BytesCursorScanner::visit(IndexAccess const& _node) {
+	auto base = to<Identifier>(&_node.baseExpression());
+	auto index = to<Identifier>(_node.indexExpression());
+	if (base == nullptr || index == nullptr || _node.annotation().lValueRequested) {
+		return true;
+	}
+	auto arrayType = to<ArrayType>(base->annotation().type);
+	auto bytes = to<VariableDeclaration>(base->annotation().referencedDeclaration);
+	if (arrayType && arrayType->isByteArray() && bytes && !bytes->isStateVariable() &&
+		index->annotation().referencedDeclaration == m_loopVar
+	) {
+		m_reads[bytes].push_back(&_node);
+	}
+	return true;
+}
+
+bool BytesCursorScanner::visit(Assignment const& _node) {
+	markChanged(_node.leftHandSide());
+	return true;
+}
+
+bool BytesCursorScanner::visit(UnaryOperation const& _node) {
+	if (isIn(_node.getOperator(), Token::Inc, Token::Dec, Token::Delete)) {
+		markChanged(_node.subExpression());
+	}
+	return true;
+}
+
+bool BytesCursorScanner::visit(MemberAccess const& _node) {
+	auto arrayType = to<ArrayType>(_node.expression().annotation().type);
+	if (arrayType && arrayType->isByteArray() && !isIn(_node.memberName(), "length", "empty", "toSlice")) {
+		markChanged(_node.expression());
+	}
+	return true;
+}
+
+VariableDeclaration const* BytesCursorScanner::findLoopVar(ForStatement const& _forStatement) {
+	auto init = to<VariableDeclarationStatement>(_forStatement.initializationExpression());
+	if (init == nullptr || init->declarations().size() != 1 || init->declarations().at(0) == nullptr ||
+		init->initialValue() == nullptr
+	) {
+		return nullptr;
+	}
+	auto isConst = [](Expression const* e, int value) {
+		auto number = to<RationalNumberType>(e->annotation().type);
+		return number && !number->isFractional() && number->literalValue(nullptr) == value;
+	};
+	VariableDeclaration const* loopVar = init->declarations().at(0).get();
+	if (!to<IntegerType>(loopVar->type()) || !isConst(init->initialValue(), 0)) {
+		return nullptr;
+	}
+
+	auto loopExpr = _forStatement.loopExpression();
+	if (loopExpr == nullptr) {
+		return nullptr;
+	}
+	auto isLoopVar = [&](Expression const& e) {
+		auto id = to<Identifier>(&e);
+		return id && id->annotation().referencedDeclaration == loopVar;
+	};
+	auto unary = to<UnaryOperation>(&loopExpr->expression());
+	auto assign = to<Assignment>(&loopExpr->expression());
+	bool isStep =
+		(unary && unary->getOperator() == Token::Inc && isLoopVar(unary->subExpression())) ||
+		(assign && assign->assignmentOperator() == Token::AssignAdd && isLoopVar(assign->leftHandSide()) &&
+		 isConst(&assign->rightHandSide(), 1));
+	return isStep ? loopVar : nullptr;
+}
+
+void BytesCursorScanner::markChanged(Expression const& _lValue) {
+	if (auto tuple = to<TupleExpression>(&_lValue)) {
+		for (const ASTPointer<Expression>& c : tuple->components()) {
+			if (c) {
+				markChanged(*c);
+			}
+		}
+	} else if (auto indexAccess = to<IndexAccess>(&_lValue)) {
+		markChanged(indexAccess->baseExpression());
+	} else if (auto indexRangeAccess = to<IndexRangeAccess>(&_lValue)) {
+		markChanged(indexRangeAccess->baseExpression());
+	} else if (auto memberAccess = to<MemberAccess>(&_lValue)) {
+		markChanged(memberAccess->expression());
+	} else if (auto id = to<Identifier>(&_lValue)) {
+		m_changed.insert(id->annotation().referencedDeclaration);
+	}
+}
+
+MsgMagicScanner::MsgMagicScanner(ASTNode const& _node) {
+	_node.accept(*this);
+}
+
+bool MsgMagicScanner::visit(MemberAccess const& _node) {
+	auto identifier = to<Identifier>(&_node.expression());
+	if (identifier && identifier->name() == "msg" &&
+		_node.expression().annotation().type->category() == Type::Category::Magic &&
+		isIn(_node.memberName(), "value", "createdAt", "currencies", "isInternal", "isExternal", "isTickTock")
+	) {
+		m_reads[_node.memberName()].push_back(&_node);
+	}
+	return true;
+}
+
+LoopBodyScanner::LoopBodyScanner(Statement const& _body) {
+	_body.accept(*this);
+}
+
+bool LoopBodyScanner::visitNode(ASTNode const&) {
+	++m_nodeQty;
+	return true;
+}
+
+bool LoopBodyScanner::visit(Assignment const& _node) {
+	markChanged(_node.leftHandSide());
+	return visitNode(_node);
+}
+
+bool LoopBodyScanner::visit(UnaryOperation const& _node) {
+	if (isIn(_node.getOperator(), Token::Inc, Token::Dec, Token::Delete)) {
+		markChanged(_node.subExpression());
+	}
+	return visitNode(_node);
+}
+
+void LoopBodyScanner::markChanged(Expression const& _lValue) {
+	if (auto tuple = to<TupleExpression>(&_lValue)) {
+		for (const ASTPointer<Expression>& c : tuple->components()) {
+			if (c) {
+				markChanged(*c);
+			}
+		}
+	} else if (auto id = to<Identifier>(&_lValue)) {
+		m_changed.insert(id->annotation().referencedDeclaration);
+	}
+}
+
+LoopStateVarScanner::LoopStateVarScanner(Statement const& _loop) {
+	_loop.accept(*this);
+}
+
+std::vector<std::pair<VariableDeclaration const*, bool>> LoopStateVarScanner::variables() const {
+	std::vector<std::pair<VariableDeclaration const*, bool>> res;
+	if (m_hasObservingCall) {
+		return res;
+	}
+	for (const auto& [vd, count] : m_useCount) {
+		bool isWritten = m_written.count(vd) != 0;
+		if (!(m_canReturn && isWritten)) {
+			res.emplace_back(vd, isWritten);
+		}
+	}
+	std::stable_sort(res.begin(), res.end(), [&](const auto& a, const auto& b) {
+		return m_useCount.at(a.first) > m_useCount.at(b.first);
+	});
+	return res;
+}
+
+bool LoopStateVarScanner::visit(Identifier const& _node) {
+	auto vd = to<VariableDeclaration>(_node.annotation().referencedDeclaration);
+	if (vd && vd->isStateVariable() && !vd->isConstant()) {
+		++m_useCount[vd];
+	}
+	return true;
+}
+
+bool LoopStateVarScanner::visit(Assignment const& _node) {
+	markWritten(_node.leftHandSide());
+	return true;
+}
+
+bool LoopStateVarScanner::visit(UnaryOperation const& _node) {
+	if (isIn(_node.getOperator(), Token::Inc, Token::Dec, Token::Delete)) {
+		markWritten(_node.subExpression());
+	}
+	return true;
+}
+
+bool LoopStateVarScanner::visit(FunctionCall const& _node) {
+	auto funcType = to<FunctionType>(_node.expression().annotation().type);
+	if (funcType == nullptr) {
+		return true;
+	}
+	switch (funcType->kind()) {
+		// these run code that reads or writes state variables
+		case FunctionType::Kind::Internal:
+		case FunctionType::Kind::DelegateCall:
+		case FunctionType::Kind::TVMCommit:
+		case FunctionType::Kind::TVMExit:
+		case FunctionType::Kind::TVMExit1:
+		case FunctionType::Kind::TVMResetStorage:
+		case FunctionType::Kind::Selfdestruct:
+			m_hasObservingCall = true;
+			break;
+		default:
+			break;
+	}
+	// methods like `m.push()` or `m.delMin()` modify the object they are called on
+	if (auto memberAccess = to<MemberAccess>(&_node.expression())) {
+		markWritten(memberAccess->expression());
+	}
+	return true;
+}
+
+void LoopStateVarScanner::markWritten(Expression const& _lValue) {
+	if (auto tuple = to<TupleExpression>(&_lValue)) {
+		for (const ASTPointer<Expression>& c : tuple->components()) {
+			if (c) {
+				markWritten(*c);
+			}
+		}
+	} else if (auto indexAccess = to<IndexAccess>(&_lValue)) {
+		markWritten(indexAccess->baseExpression());
+	} else if (auto memberAccess = to<MemberAccess>(&_lValue)) {
+		markWritten(memberAccess->expression());
+	} else if (auto id = to<Identifier>(&_lValue)) {
+		if (auto vd = to<VariableDeclaration>(id->annotation().referencedDeclaration)) {
+			m_written.insert(vd);
+		}
+	}
+}
+
 LocationReturn notNeedsPushContWhenInlining(const Block &_block) {
 
 	ast_vec<Statement> statements = _block.statements();
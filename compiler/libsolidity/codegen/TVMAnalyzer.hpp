@@ -136,6 +136,91 @@ public:
 
 }
 
+/// Finds `b[i]` reads in a `for (uint i = 0; ...; i++)` loop that can be served by a slice cursor
+/// stepped together with `i`. Neither `b` nor `i` may be changed in the condition or the body.
+class BytesCursorScanner: public ASTConstVisitor
+{
+public:
+	explicit BytesCursorScanner(ForStatement const& _forStatement);
+	/// @returns bytes variables with the reads that can use their cursor, empty if the loop doesn't fit
+	std::map<VariableDeclaration const*, std::vector<IndexAccess const*>> cursors() const;
+
+protected:
+	bool visit(IndexAccess const& _node) override;
+	bool visit(Assignment const& _node) override;
+	bool visit(UnaryOperation const& _node) override;
+	bool visit(MemberAccess const& _node) override;
+
+private:
+	static VariableDeclaration const* findLoopVar(ForStatement const& _forStatement);
+	void markChanged(Expression const& _lValue);
+
+	VariableDeclaration const* m_loopVar{};
+	std::map<VariableDeclaration const*, std::vector<IndexAccess const*>> m_reads;
+	std::set<Declaration const*> m_changed;
+};
+
+/// Groups reads of `msg` members that take several opcodes to compute but can't change during a function
+class MsgMagicScanner: public ASTConstVisitor
+{
+public:
+	explicit MsgMagicScanner(ASTNode const& _node);
+	/// @returns member name -> all reads of it
+	std::map<std::string, std::vector<MemberAccess const*>> const& reads() const { return m_reads; }
+
+protected:
+	bool visit(MemberAccess const& _node) override;
+
+private:
+	std::map<std::string, std::vector<MemberAccess const*>> m_reads;
+};
+
+/// Finds state variables used in a loop that can be kept on the stack while it runs.
+/// Nothing is cached if the loop calls something that can observe the state variables,
+/// and only variables that aren't written are cached if the loop can return.
+class LoopStateVarScanner: public ASTConstVisitor
+{
+public:
+	explicit LoopStateVarScanner(Statement const& _loop);
+	/// @returns variables to cache, the most used first, with a flag whether the loop writes them
+	std::vector<std::pair<VariableDeclaration const*, bool>> variables() const;
+
+protected:
+	bool visit(Identifier const& _node) override;
+	bool visit(Assignment const& _node) override;
+	bool visit(UnaryOperation const& _node) override;
+	bool visit(FunctionCall const& _node) override;
+	void endVisit(Return const&) override { m_canReturn = true; }
+
+private:
+	void markWritten(Expression const& _lValue);
+
+	std::map<VariableDeclaration const*, int> m_useCount;
+	std::set<VariableDeclaration const*> m_written;
+	bool m_hasObservingCall{};
+	bool m_canReturn{};
+};
+
+/// Measures a loop body for unrolling and finds the variables it assigns
+class LoopBodyScanner: public ASTConstVisitor
+{
+public:
+	explicit LoopBodyScanner(Statement const& _body);
+	int nodeQty() const { return m_nodeQty; }
+	bool changes(Declaration const* _decl) const { return m_changed.count(_decl) != 0; }
+
+protected:
+	bool visitNode(ASTNode const&) override;
+	bool visit(Assignment const& _node) override;
+	bool visit(UnaryOperation const& _node) override;
+
+private:
+	void markChanged(Expression const& _lValue);
+
+	int m_nodeQty{};
+	std::set<Declaration const*> m_changed;
+};
+
 LocationReturn notNeedsPushContWhenInlining(Block const &_block);
 
 bool isFunctionOfFirstType(FunctionDefinition const* f);
@@ -267,6 +267,12 @@ public:
 		});
 	}
 
+	bool haveOptimizeStorage() const {
+		return std::any_of(pragmaDirectives.begin(), pragmaDirectives.end(), [](const auto& pd){
+			return pd->literals().size() == 1 && pd->literals()[0] == "optimizeStorage";
+		});
+	}
+
 	ASTPointer<Expression> haveMsgValue() const {
 		for (PragmaDirective const *pd : pragmaDirectives) {
 			if (pd->literals().size() == 1 &&
@@ -17,8 +17,10 @@
  */
 
 #include <solidity/BuildInfo.h>
+#include <libsolutil/JSON.h>
 
 #include <boost/algorithm/string/replace.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/range/adaptor/map.hpp>
 
 #include "TVMABI.hpp"
@@ -208,11 +210,60 @@ void TVMContractCompiler::proceedContract(
     cout << "Code was generated and saved to file " << fileName << endl;
 }
 
-static void optimize_and_append_code(CodeLines& code, const StackPusherHelper& pusher) {
-	if (GlobalParams::g_withOptimizations)
-		code.append(optimize_code(pusher.code()));
-	else
-		code.append(pusher.code());
+void TVMContractCompiler::generateStorageLayout(
+	const std::string& fileName,
+	ContractDefinition const& contract,
+	PragmaDirectiveHelper const &pragmaHelper
+) {
+	// The manifest describes the order of state variables in c4 and the cell of each one.
+	// Use it to decode the old data in onCodeUpgrade.
+	TVMCompilerContext ctx{&contract, pragmaHelper};
+	std::vector<Type const*> types = ctx.notConstantStateVariableTypes();
+	EncodePosition position{ctx.getOffsetC4(), types};
+
+	int cell = 0;
+	std::optional<int> firstCell;
+	std::function<void(Type const*)> walk = [&](Type const* type) {
+		if (auto structType = to<StructType>(type)) {
+			for (const ASTPointer<VariableDeclaration>& m : structType->structDefinition().members()) {
+				walk(m->type());
+			}
+		} else {
+			if (position.needNewCell(type)) {
+				++cell;
+			}
+			if (!firstCell.has_value()) {
+				firstCell = cell;
+			}
+		}
+	};
+
+	Json::Value variables(Json::arrayValue);
+	for (VariableDeclaration const* v : ctx.c4StateVariables()) {
+		firstCell.reset();
+		walk(v->type());
+		Json::Value var(Json::objectValue);
+		var["name"] = v->name();
+		var["type"] = v->type()->toString(true);
+		var["contract"] = to<ContractDefinition>(v->scope())->name();
+		var["firstCell"] = firstCell.value_or(cell);
+		var["lastCell"] = cell;
+		variables.append(var);
+	}
+
+	Json::Value root(Json::objectValue);
+	root["contract"] = contract.name();
+	root["offset"] = ctx.getOffsetC4();
+	root["cells"] = position.countOfCreatedBuilders() + 1;
+	root["variables"] = variables;
+
+	ofstream ofile;
+	ofile.open(fileName);
+	if (!ofile)
+		fatal_error("Failed to open the output file: " + fileName);
+	ofile << util::jsonPrettyPrint(root) << endl;
+	ofile.close();
+	cout << "Storage layout was generated and saved to file " << fileName << endl;
 }
 
 CodeLines
@@ -223,6 +274,19 @@ TVMContractCompiler::generateContractCode(
 	TVMCompilerContext ctx{contract, pragmaHelper};
 	CodeLines code;
 
+	std::optional<OptimizedCodeCache> cache;
+	if (GlobalParams::g_withOptimizations && !GlobalParams::g_optimizerCacheFolder.empty()) {
+		cache.emplace((boost::filesystem::path(GlobalParams::g_optimizerCacheFolder) / (contract->name() + ".optcache")).string());
+	}
+	auto optimize_and_append_code = [&cache](CodeLines& output, const StackPusherHelper& pusher) {
+		if (cache)
+			output.append(cache->optimize(pusher.code()));
+		else if (GlobalParams::g_withOptimizations)
+			output.append(optimize_code(pusher.code()));
+		else
+			output.append(pusher.code());
+	};
+
 	if (!ctx.isStdlib()) {
 		code.push(string{} + ".version sol " + ETH_PROJECT_VERSION);
 		code.push(" ");
@@ -410,6 +474,9 @@ TVMContractCompiler::generateContractCode(
 		code = tmp;
 	}
 
+	if (cache) {
+		cache->save();
+	}
 	return code;
 }
 
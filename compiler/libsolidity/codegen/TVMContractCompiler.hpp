@@ -53,6 +53,11 @@ public:
 		ContractDefinition const& contract,
 		PragmaDirectiveHelper const &pragmaHelper
 	);
+	static void generateStorageLayout(
+		const std::string& fileName,
+		ContractDefinition const& contract,
+		PragmaDirectiveHelper const &pragmaHelper
+	);
 	static CodeLines generateContractCode(ContractDefinition const* contract, PragmaDirectiveHelper const& pragmaHelper);
 private:
 	static void fillInlineFunctions(TVMCompilerContext& ctx, ContractDefinition const* contract);
@@ -493,6 +493,32 @@ std::vector<Expression const *> TVMExpressionCompiler::unroll(BinaryOperation co
 	return result;
 }
 
+std::vector<Expression const*> TVMExpressionCompiler::stringConcatenationOperands(Expression const& _e) {
+	auto binOp = to<BinaryOperation>(&_e);
+	if (binOp && binOp->getOperator() == Token::Add && isString(getType(binOp))) {
+		return unroll(*binOp);
+	}
+	return {&_e};
+}
+
+void TVMExpressionCompiler::appendStrings(std::vector<Expression const*> const& tail, Type const* type) {
+	if (tail.size() == 1) {
+		compileNewExpr(tail.at(0));
+		m_pusher.hardConvert(type, getType(tail.at(0)));
+		m_pusher.pushMacroCallInCallRef(-2 + 1, "concatenateStrings_macro");
+		return;
+	}
+	// Keep appending to one builder list and assemble it once instead of
+	// rebuilding the cell chain of the left operand on each concatenation
+	m_pusher.pushMacroCallInCallRef(-1 + 2, "strToList_macro"); // list builder
+	for (Expression const* e : tail) {
+		compileNewExpr(e); // list builder str
+		m_pusher.hardConvert(type, getType(e));
+		m_pusher.pushMacroCallInCallRef(-3 + 2, "appendStringToList_macro"); // list builder
+	}
+	m_pusher.pushMacroCallInCallRef(-2 + 1, "assembleList_macro");
+}
+
 void TVMExpressionCompiler::visitBinaryOperationForString(
 	const std::function<void()>& pushLeft,
 	const std::function<void()>& pushRight,
@@ -503,7 +529,11 @@ void TVMExpressionCompiler::visitBinaryOperationForString(
 		pushRight();
 		m_pusher.pushMacroCallInCallRef(-2 +1, "concatenateStrings_macro");
 	} else if (op == Token::Equal || op == Token::NotEqual) {
-		visitBinaryOperationForTvmCell(pushLeft, pushRight, op);
+		pushLeft();
+		pushRight();
+		m_pusher.pushMacroCallInCallRef(-2 + 1, "equalStrings_macro");
+		if (op == Token::NotEqual)
+			m_pusher.push(0, "NOT");
 	} else if (TokenTraits::isCompareOp(op)){
 		pushLeft();
 		pushRight();
@@ -591,13 +621,26 @@ void TVMExpressionCompiler::visit2(BinaryOperation const &_binaryOperation) {
 	};
 
 	if (isString(lt) && isString(rt)) {
+		if (op == Token::Add) {
+			std::vector<Expression const*> operands = stringConcatenationOperands(_binaryOperation);
+			if (operands.size() > 2) {
+				compileNewExpr(operands.at(0));
+				m_pusher.hardConvert(commonType, getType(operands.at(0)));
+				operands.erase(operands.begin());
+				appendStrings(operands, commonType);
+				return;
+			}
+		}
+		visitBinaryOperationForString(acceptLeft, acceptRight, op);
+		return;
+	}
+
+	if (isByteArrayOrString(lt) && isByteArrayOrString(rt)) {
 		visitBinaryOperationForString(acceptLeft, acceptRight, op);
 		return;
 	}
 
-	if ((lt->category() == Type::Category::TvmCell &&
-		 rt->category() == Type::Category::TvmCell) ||
-		(isByteArrayOrString(lt) && isByteArrayOrString(rt))) {
+	if (lt->category() == Type::Category::TvmCell && rt->category() == Type::Category::TvmCell) {
 		visitBinaryOperationForTvmCell(acceptLeft, acceptRight, op);
 		return;
 	}
@@ -614,8 +657,6 @@ void TVMExpressionCompiler::visit2(BinaryOperation const &_binaryOperation) {
 		return;
 	}
 
-	acceptLeft();
-	m_pusher.push(0, string(";; ") + TokenTraits::toString(_binaryOperation.getOperator()));
 	if (op == Token::SHR) cast_error(_binaryOperation, "Unsupported operation >>>");
 	if (op == Token::Comma) cast_error(_binaryOperation, "Unsupported operation ,");
 
@@ -623,7 +664,44 @@ void TVMExpressionCompiler::visit2(BinaryOperation const &_binaryOperation) {
 	std::optional<bigint> rightValue;
 	if (val.has_value())
 		rightValue = val;
-	visitMathBinaryOperation(op, commonType, acceptRight, rightValue);
+	std::optional<bigint> leftValue;
+	if (op == Token::Exp)
+		leftValue = constValue(lexp);
+
+	if (op == Token::Exp && !rightValue.has_value() && leftValue.has_value() && to<IntegerType>(commonType)) {
+		// (2**k)**n == 1 << (k * n)
+		const unsigned msb = *leftValue > 0 ? boost::multiprecision::msb(*leftValue) : 0;
+		if (msb >= 1 && *leftValue == bigint(1) << msb) {
+			m_pusher.push(0, string(";; ") + TokenTraits::toString(op));
+			visitExpWithPowerOfTwoBase(msb, commonType, acceptRight);
+			return;
+		}
+	}
+
+	acceptLeft();
+	m_pusher.push(0, string(";; ") + TokenTraits::toString(_binaryOperation.getOperator()));
+	visitMathBinaryOperation(op, commonType, acceptRight, rightValue, leftValue);
+}
+
+void TVMExpressionCompiler::visitExpWithPowerOfTwoBase(
+	unsigned power,
+	Type const* commonType,
+	const std::function<void()>& pushRight
+) {
+	m_pusher.pushInt(1);
+	pushRight(); // 1 n
+	if (power != 1) {
+		m_pusher.pushInt(power);
+		m_pusher.push(-2 + 1, "MUL");
+	}
+	// LSHIFT takes a shift of at most 1023. A bigger one can only overflow, so clamp it
+	// to get the same integer overflow as the multiplication loop instead of a range check error
+	m_pusher.pushInt(1023);
+	m_pusher.push(-2 + 1, "MIN");
+	m_pusher.push(-2 + 1, "LSHIFT");
+	if (!m_pusher.ctx().ignoreIntegerOverflow() && !isCheckFitUseless(commonType, Token::Exp)) {
+		m_pusher.checkFit(commonType);
+	}
 }
 
 bool TVMExpressionCompiler::isCheckFitUseless(Type const* commonType, Token op) {
@@ -642,11 +720,14 @@ void TVMExpressionCompiler::visitMathBinaryOperation(
 	const Token op,
 	Type const* commonType,
 	const std::function<void()>& pushRight,
-	const std::optional<bigint>& rightValue
+	const std::optional<bigint>& rightValue,
+	const std::optional<bigint>& leftValue
 ) {
 	bool checkOverflow = false;
 	if (op == Token::Exp) {
-		if (rightValue.has_value() && (*rightValue == 2 || *rightValue == 3 || *rightValue == 4)) {
+		if (rightValue.has_value() && *rightValue == 1) {
+			// a**1 == a
+		} else if (rightValue.has_value() && (*rightValue == 2 || *rightValue == 3 || *rightValue == 4)) {
 			if (*rightValue == 2) {
 				m_pusher.pushS(0);
 				m_pusher.push(-2 + 1, "MUL");
@@ -663,11 +744,35 @@ void TVMExpressionCompiler::visitMathBinaryOperation(
 			} else {
 				solUnimplemented("");
 			}
+		} else if (rightValue.has_value() && 4 < *rightValue && *rightValue < 256) {
+			// left-to-right binary method: square for each bit, multiply by the base for each set bit
+			const int e = static_cast<int>(*rightValue);
+			const int msb = boost::multiprecision::msb(*rightValue);
+			const bool needBase = e != (1 << msb);
+			if (needBase) {
+				m_pusher.pushS(0); // a r
+			}
+			for (int bit = msb - 1; bit >= 0; --bit) {
+				m_pusher.pushS(0);
+				m_pusher.push(-2 + 1, "MUL");
+				if ((e >> bit) & 1) {
+					m_pusher.pushS(1);
+					m_pusher.push(-2 + 1, "MUL");
+				}
+			}
+			if (needBase) {
+				m_pusher.popS(1);
+			}
 		} else {
 			pushRight();
-			m_pusher.push(+2, "DUP2");
-			m_pusher.push(-2 + 1, "OR");
-			m_pusher.push(-1, "THROWIFNOT " + toString(TvmConst::RuntimeException::Exponent00));
+			const bool isNonZero =
+				(leftValue.has_value() && *leftValue != 0) ||
+				(rightValue.has_value() && *rightValue != 0);
+			if (!isNonZero) {
+				m_pusher.push(+2, "DUP2");
+				m_pusher.push(-2 + 1, "OR");
+				m_pusher.push(-1, "THROWIFNOT " + toString(TvmConst::RuntimeException::Exponent00));
+			}
 			m_pusher.pushMacroCallInCallRef(-2 + 1, "__exp_macro");
 		}
 		checkOverflow = true;
@@ -740,6 +845,11 @@ void TVMExpressionCompiler::visitMsgMagic(MemberAccess const &_node) {
 	// (DEPTH - 5) - transaction id (-2, -1, 0) for int, ext and ticktock
 
 
+	if (std::optional<int> pos = m_pusher.ctx().cachedValue(&_node)) {
+		m_pusher.pushS(m_pusher.getStack().getOffset(*pos));
+		return;
+	}
+
 	if (_node.memberName() == "sender") { // msg.sender
 		m_pusher.getGlob(TvmConst::C7::SenderAddress);
 	} else if (_node.memberName() == "value") { // msg.value
@@ -999,6 +1109,11 @@ void TVMExpressionCompiler::visit2(IndexAccess const &indexAccess) {
 	if (baseType->category() == Type::Category::Array) {
 		auto baseArrayType = to<ArrayType>(baseType);
 		if (baseArrayType->isByteArray()) {
+			if (std::optional<int> cursorPos = m_pusher.ctx().bytesCursor(&indexAccess)) {
+				m_pusher.pushS(m_pusher.getStack().getOffset(*cursorPos)); // cursor
+				m_pusher.push(-1 + 1, "PLDU 8");
+				return;
+			}
 			acceptExpr(&indexAccess.baseExpression()); // bytes
 			m_pusher.push(-1 + 1, "CTOS");
 			compileNewExpr(indexAccess.indexExpression()); // slice index
@@ -1364,7 +1479,7 @@ bool TVMExpressionCompiler::tryAssignLValue(Assignment const &_assignment) {
 		if (isString(getType(&lhs)) && isString(getType(&rhs))) {
 			m_pusher.pushMacroCallInCallRef(-2 + 1, "concatenateStrings_macro");
 		} else {
-			visitMathBinaryOperation(binOp, commonType, nullptr, nullopt);
+			visitMathBinaryOperation(binOp, commonType, nullptr, nullopt, nullopt);
 		}
 
 		if (isCurrentResultNeeded()) {
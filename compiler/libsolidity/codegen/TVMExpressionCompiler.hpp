@@ -39,6 +39,8 @@ public:
 			Type const* rightType = nullptr
 	);
 	void collectLValue(const LValueInfo &lValueInfo, bool haveValueOnStackTop, bool isValueBuilder);
+	static std::vector<Expression const*> stringConcatenationOperands(Expression const& _e);
+	void appendStrings(std::vector<Expression const*> const& tail, Type const* type);
 
 protected:
 	bool acceptExpr(const Expression* expr);
@@ -75,7 +77,13 @@ protected:
 		Token op,
 		Type const* commonType,
 		const std::function<void()>& pushRight,
-		const std::optional<bigint>& rightValue
+		const std::optional<bigint>& rightValue,
+		const std::optional<bigint>& leftValue
+	);
+	void visitExpWithPowerOfTwoBase(
+		unsigned power,
+		Type const* commonType,
+		const std::function<void()>& pushRight
 	);
 	void visitMsgMagic(MemberAccess const& _node);
 	void visitMagic(MemberAccess const& _node);
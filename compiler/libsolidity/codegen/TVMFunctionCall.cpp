@@ -1562,8 +1562,10 @@ IFELSE
 		m_exprCompiler->collectLValue(lValueInfo, true, false);
 	} else if (_node.memberName() == "append") {
 		const LValueInfo lValueInfo = m_exprCompiler->expandLValue(&_node.expression(), true);
-		pushArgAndConvert(0);
-		m_pusher.pushMacroCallInCallRef(-2 +1, "concatenateStrings_macro");
+		m_exprCompiler->appendStrings(
+			TVMExpressionCompiler::stringConcatenationOperands(*m_arguments.at(0)),
+			_node.expression().annotation().type
+		);
 		m_exprCompiler->collectLValue(lValueInfo, true, false);
 	} else {
 		solUnimplemented("");
@@ -2656,21 +2658,43 @@ IF
 				formatStr = formatStr.substr(close_pos + 1);
 				pos = 0;
 			}
+			if (substrings.empty() && !formatStr.empty()) {
+				// there are no arguments, so the result is a constant string
+				m_pusher.pushString(formatStr, false);
+				return true;
+			}
 			// create new vector(TvmBuilder)
 			m_pusher.push(+1, "NIL");
 			// create new builder to store data in it
 			m_pusher.push(+1, "NEWC");
 
+			// Upper bound of the number of bytes in the builder if it's known at compile time.
+			// storeStringInBuilders stores at most 127 bytes in one builder.
+			const int maxBuilderBytes = (TvmConst::CellBitLength - 7) / 8;
+			std::optional<int> builderBytes = 0;
 			auto pushConstStr = [&](const string& constStr) {
-                if (!constStr.empty()) {
-                    size_t maxSlice = TvmConst::CellBitLength / 8;
-                    for(size_t i = 0; i  < constStr.length(); i += maxSlice) {
-                        m_pusher.pushString(constStr.substr(i, min(maxSlice, constStr.length() - i)), true);
-                        // stack: vector(TvmBuilder) builder Slice
-                        m_pusher.pushMacroCallInCallRef(-1, "storeStringInBuilders_macro");
+                if (constStr.empty()) {
+                    return;
+                }
+                if (builderBytes.has_value() && *builderBytes + static_cast<int>(constStr.length()) <= maxBuilderBytes) {
+                    // the builder has enough space, so store the slice without checks
+                    if (8 * constStr.length() <= TvmConst::MaxSTSLICECONST) {
+                        m_pusher.push(0, "STSLICECONST x" + stringToBytes(constStr));
+                    } else {
+                        m_pusher.pushString(constStr, true);
+                        m_pusher.push(-1, "STSLICER");
                     }
-                    // stack: vector(TvmBuilder) builder
+                    *builderBytes += constStr.length();
+                    return;
+                }
+                size_t maxSlice = TvmConst::CellBitLength / 8;
+                for(size_t i = 0; i  < constStr.length(); i += maxSlice) {
+                    m_pusher.pushString(constStr.substr(i, min(maxSlice, constStr.length() - i)), true);
+                    // stack: vector(TvmBuilder) builder Slice
+                    m_pusher.pushMacroCallInCallRef(-1, "storeStringInBuilders_macro");
                 }
+                // stack: vector(TvmBuilder) builder
+                builderBytes.reset();
 			};
 			for (size_t it = 0; it < substrings.size(); it++) {
 				// stack: vector(TvmBuilder) builder
@@ -2696,9 +2720,21 @@ IF
 							solUnimplemented("Width should be a positive integer.");
 						auto mt = m_arguments[it + 1]->annotation().type->mobileType();
 						auto isInt = dynamic_cast<IntegerType const *>(mt);
-						acceptExpr(m_arguments[it + 1].get());
-						if (isInt->isSigned())
-							m_pusher.push(0, "ABS");
+						std::optional<bigint> value = TVMExpressionCompiler::constValue(*m_arguments[it + 1]);
+						bool signOnStack = false;
+						if (value.has_value()) {
+							m_pusher.pushInt(boost::multiprecision::abs(*value));
+						} else {
+							acceptExpr(m_arguments[it + 1].get());
+							if (isInt->isSigned()) {
+								m_pusher.pushS(0);
+								m_pusher.push(0, "ABS");
+								m_pusher.exchange(0, 1);
+								m_pusher.push(0, "ISNEG");
+								// stack: vector(TvmBuilder) builder abs(number) addMinus
+								signOnStack = true;
+							}
+						}
 						m_pusher.pushInt(width);
 						m_pusher.push(+1, leadingZeroes ? "TRUE" : "FALSE");
 						if (isHex) {
@@ -2707,23 +2743,42 @@ IF
 							else
 								m_pusher.push(+1, "FALSE");
 						}
-						if (isInt->isSigned()) {
-							acceptExpr(m_arguments[it + 1].get());
-							m_pusher.push(0, "ISNEG");
+						if (signOnStack) {
+							m_pusher.blockSwap(1, isHex ? 3 : 2);
 						} else {
-							m_pusher.push(+1, "FALSE");
+							m_pusher.push(+1, value.has_value() && *value < 0 ? "TRUE" : "FALSE");
 						}
-						// stack: vector(TvmBuilder) builder abs(number) width leadingZeroes addMinus
+						// stack: vector(TvmBuilder) builder abs(number) width leadingZeroes [isLower] addMinus
 						if (isHex) {
 							m_pusher.pushMacroCallInCallRef(-5, "convertIntToHexStr_macro");
 						} else {
 							m_pusher.pushMacroCallInCallRef(-4, "convertIntToDecStr_macro");
 						}
 						// stack: vector(TvmBuilder) builder
+
+						// The number is not longer than its type or value allows, so the builder
+						// keeps a known bound while the number can't overflow it.
+						if (builderBytes.has_value()) {
+							bigint maxAbs = value.has_value() ? bigint(boost::multiprecision::abs(*value)) :
+								isInt->isSigned() ? bigint(1) << (isInt->numBits() - 1) : (bigint(1) << isInt->numBits()) - 1;
+							int digits = 1;
+							while (maxAbs >= (isHex ? 16 : 10)) {
+								maxAbs /= isHex ? 16 : 10;
+								++digits;
+							}
+							const bool withMinus = value.has_value() ? *value < 0 : isInt->isSigned();
+							const int maxLength = (withMinus ? 1 : 0) + std::max(width, digits);
+							if (*builderBytes + maxLength <= maxBuilderBytes) {
+								*builderBytes += maxLength;
+							} else {
+								builderBytes.reset();
+							}
+						}
 					} else {
 						acceptExpr(m_arguments[it + 1].get());
 						m_pusher.pushInt(9);
 						m_pusher.pushMacroCallInCallRef(-2, "convertFixedPointToString_macro");
+						builderBytes.reset();
 					}
 				} else if (cat == Type::Category::Address) {
 					// stack: vector(TvmBuilder) builder
@@ -2731,6 +2786,7 @@ IF
 					// stack: vector(TvmBuilder) builder address
 					m_pusher.pushMacroCallInCallRef(-1, "convertAddressToHexString_macro");
 					// stack: vector(TvmBuilder) builder
+					builderBytes.reset();
 				} else if (isStringOrStringLiteralOrBytes(argType)) {
 					// stack: vector(TvmBuilder) builder
 					acceptExpr(m_arguments[it + 1].get());
@@ -2739,11 +2795,13 @@ IF
 					// stack: vector(TvmBuilder) builder string(slice)
 					m_pusher.pushMacroCallInCallRef(-1, "storeStringInBuilders_macro");
 					// stack: vector(TvmBuilder) builder
+					builderBytes.reset();
 				} else if (cat == Type::Category::FixedPoint) {
 					int power = to<FixedPointType>(argType)->fractionalDigits();
 					acceptExpr(m_arguments[it + 1].get());
 					m_pusher.pushInt(power);
 					m_pusher.pushMacroCallInCallRef(-2, "convertFixedPointToString_macro");
+					builderBytes.reset();
 				} else {
 					cast_error(*m_arguments[it + 1].get(), "Unsupported argument type");
 				}
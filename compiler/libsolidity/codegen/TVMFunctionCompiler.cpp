@@ -18,7 +18,7 @@
 
 #include <boost/algorithm/string/replace.hpp>
 
-#include <liblangutil/SourceReferenceExtractor.h>
+#include <liblangutil/CharStream.h>
 
 #include "DictOperations.hpp"
 #include "TVM.h"
@@ -731,11 +731,33 @@ bool TVMFunctionCompiler::visit(VariableDeclarationStatement const &_variableDec
 
 bool TVMFunctionCompiler::visit(Block const & _block) {
 	const int startStackSize = m_pusher.getStack().size();
+	std::vector<Expression const*> cachedValues;
+	if (m_function && &_block == &m_function->body()) {
+		// msg members that are read more than once are computed once and kept on the stack
+		MsgMagicScanner scanner{_block};
+		for (const auto& [name, reads] : scanner.reads()) {
+			if (reads.size() < 2) {
+				continue;
+			}
+			m_pusher.push(0, ";; cache msg." + name);
+			acceptExpr(reads.at(0), true);
+			const int pos = m_pusher.getStack().size() - 1;
+			for (MemberAccess const* read : reads) {
+				m_pusher.ctx().setCachedValue(read, pos);
+				cachedValues.push_back(read);
+			}
+		}
+	}
+
 	for (const ASTPointer<Statement>& s : _block.statements()) {
         pushLocation(*s.get());
 		s->accept(*this);
 	}
 
+	for (Expression const* e : cachedValues) {
+		m_pusher.ctx().removeCachedValue(e);
+	}
+
 	const int delta = m_pusher.getStack().size() - startStackSize;
 	solAssert(delta >= 0, "");
 	if (!_block.statements().empty() && to<Return>(_block.statements().back().get()) == nullptr) {
@@ -978,10 +1000,12 @@ void TVMFunctionCompiler::afterLoopCheck(const ContInfo& ci, const int& loopVarQ
 }
 
 bool TVMFunctionCompiler::visit(WhileStatement const &_whileStatement) {
+	const std::vector<std::pair<VariableDeclaration const*, bool>> cachedStateVars = pushLoopStateVariables(_whileStatement);
 	int saveStackSizeForWhile = m_pusher.getStack().size();
 
 	if (_whileStatement.loopType() == WhileStatement::LoopType::DO_WHILE) {
 		doWhile(_whileStatement);
+		popLoopStateVariables(cachedStateVars);
 		return false;
 	}
 
@@ -993,6 +1017,18 @@ bool TVMFunctionCompiler::visit(WhileStatement const &_whileStatement) {
 
 	int saveStackSize = m_pusher.getStack().size();
 
+	if (_whileStatement.loopType() == WhileStatement::LoopType::REPEAT && !ci.mayDoThat()) {
+		const std::optional<bigint> count = TVMExpressionCompiler::constValue(_whileStatement.condition());
+		if (count.has_value() && *count < bigint(1) << 31) {
+			// REPEAT does nothing for a negative count
+			visitBodyOfConstantLoop(std::max(*count, bigint(0)), _whileStatement.body(), {});
+			m_pusher.push(0, "; end while");
+			m_pusher.getStack().ensureSize(saveStackSizeForWhile, "");
+			popLoopStateVariables(cachedStateVars);
+			return false;
+		}
+	}
+
 	// condition
 	if (_whileStatement.loopType() == WhileStatement::LoopType::REPEAT) {
 		if (ci.mayDoThat()) {
@@ -1027,11 +1063,52 @@ bool TVMFunctionCompiler::visit(WhileStatement const &_whileStatement) {
 	m_pusher.push(0, "; end while");
 
 	m_pusher.getStack().ensureSize(saveStackSizeForWhile, "");
+	popLoopStateVariables(cachedStateVars);
 
 	return false;
 }
 
+std::vector<std::pair<VariableDeclaration const*, bool>>
+TVMFunctionCompiler::pushLoopStateVariables(Statement const& _loop) {
+	// State variables used in the loop live on the stack while it runs, so GETGLOB and SETGLOB in
+	// the loop become stack operations. They are registered as locals and written back after the loop.
+	constexpr int maxCachedLoopStateVariables = 4;
+	std::vector<std::pair<VariableDeclaration const*, bool>> cached;
+	LoopStateVarScanner scanner{_loop};
+	for (const auto& [vd, isWritten] : scanner.variables()) {
+		if (static_cast<int>(cached.size()) == maxCachedLoopStateVariables) {
+			break;
+		}
+		if (m_pusher.getStack().isParam(vd)) {
+			// already cached by an outer loop
+			continue;
+		}
+		m_pusher.push(0, ";; cache " + vd->name());
+		m_pusher.getGlob(vd);
+		m_pusher.getStack().add(vd, false);
+		cached.emplace_back(vd, isWritten);
+	}
+	return cached;
+}
+
+void TVMFunctionCompiler::popLoopStateVariables(std::vector<std::pair<VariableDeclaration const*, bool>> const& cached) {
+	for (const auto& [vd, isWritten] : cached) {
+		if (isWritten) {
+			m_pusher.pushS(m_pusher.getStack().getOffset(vd));
+			m_pusher.setGlob(vd);
+		}
+	}
+	m_pusher.drop(cached.size());
+	for (const auto& [vd, isWritten] : cached) {
+		m_pusher.getStack().remove(vd);
+	}
+}
+
 bool TVMFunctionCompiler::visit(ForEachStatement const& _forStatement) {
+	if (tryUnrollForEach(_forStatement)) {
+		return false;
+	}
+
 	// For bytes:
 	//
 	// cell
@@ -1208,6 +1285,141 @@ bool TVMFunctionCompiler::visit(ForEachStatement const& _forStatement) {
 	return false;
 }
 
+std::optional<bigint> TVMFunctionCompiler::constantTripCount(ForStatement const& _forStatement) {
+	// for (T i = start; i < bound; i++), where `i` is changed only by the loop expression
+	auto init = to<VariableDeclarationStatement>(_forStatement.initializationExpression());
+	if (init == nullptr || init->declarations().size() != 1 || init->declarations().at(0) == nullptr ||
+		init->initialValue() == nullptr
+	) {
+		return {};
+	}
+	VariableDeclaration const* loopVar = init->declarations().at(0).get();
+	auto intType = to<IntegerType>(loopVar->type());
+	const std::optional<bigint> start = TVMExpressionCompiler::constValue(*init->initialValue());
+	if (intType == nullptr || !start.has_value()) {
+		return {};
+	}
+
+	auto isLoopVar = [&](Expression const& e) {
+		auto id = to<Identifier>(&e);
+		return id && id->annotation().referencedDeclaration == loopVar;
+	};
+	auto cond = to<BinaryOperation>(_forStatement.condition());
+	if (cond == nullptr || !isLoopVar(cond->leftExpression())) {
+		return {};
+	}
+	const std::optional<bigint> bound = TVMExpressionCompiler::constValue(cond->rightExpression());
+	if (!bound.has_value()) {
+		return {};
+	}
+
+	auto loopExpr = _forStatement.loopExpression();
+	if (loopExpr == nullptr) {
+		return {};
+	}
+	auto unary = to<UnaryOperation>(&loopExpr->expression());
+	auto assign = to<Assignment>(&loopExpr->expression());
+	const bool isStep =
+		(unary && unary->getOperator() == Token::Inc && isLoopVar(unary->subExpression())) ||
+		(assign && assign->assignmentOperator() == Token::AssignAdd && isLoopVar(assign->leftHandSide()) &&
+		 TVMExpressionCompiler::constValue(assign->rightHandSide()) == bigint(1));
+	if (!isStep || LoopBodyScanner{_forStatement.body()}.changes(loopVar)) {
+		return {};
+	}
+
+	bigint count;
+	switch (cond->getOperator()) {
+		case Token::LessThan:
+			count = *bound - *start;
+			break;
+		case Token::LessThanOrEqual:
+			count = *bound - *start + 1;
+			break;
+		case Token::NotEqual:
+			if (*bound < *start) {
+				return {};
+			}
+			count = *bound - *start;
+			break;
+		default:
+			return {};
+	}
+	count = std::max(count, bigint(0));
+	// the loop var must not overflow and REPEAT takes a 32-bit count
+	if (*start + count > intType->maxValue() || count >= bigint(1) << 31) {
+		return {};
+	}
+	return count;
+}
+
+bool TVMFunctionCompiler::canUnroll(const bigint& iterations, Statement const& body) {
+	constexpr int maxUnrolledIterations = 8;
+	constexpr int maxUnrolledNodes = 64;
+	return iterations <= maxUnrolledIterations && iterations * LoopBodyScanner{body}.nodeQty() <= maxUnrolledNodes;
+}
+
+bool TVMFunctionCompiler::tryUnrollForEach(ForEachStatement const& _forStatement) {
+	// `for (T x : [c0, c1, ...])` over pure values becomes straight-line code
+	auto tuple = to<TupleExpression>(_forStatement.rangeExpression());
+	if (tuple == nullptr || !tuple->isInlineArray() || getInfo(_forStatement.body()).mayDoThat() ||
+		!canUnroll(tuple->components().size(), _forStatement.body())
+	) {
+		return false;
+	}
+	for (const ASTPointer<Expression>& c : tuple->components()) {
+		if (!c->annotation().isPure) {
+			return false;
+		}
+	}
+
+	auto vds = to<VariableDeclarationStatement>(_forStatement.rangeDeclaration());
+	solAssert(vds->declarations().size() == 1, "");
+	auto iterVar = vds->declarations().at(0).get();
+	const int saveStackSize = m_pusher.getStack().size();
+	m_pusher.push(0, "; for-each unrolled");
+	for (const ASTPointer<Expression>& c : tuple->components()) {
+		acceptExpr(c.get(), true);
+		m_pusher.getStack().add(iterVar, false);
+		_forStatement.body().accept(*this);
+		m_pusher.drop(m_pusher.getStack().size() - saveStackSize);
+	}
+	m_pusher.push(0, "; end for-each");
+	return true;
+}
+
+void TVMFunctionCompiler::visitBodyOfConstantLoop(
+	const bigint& tripCount,
+	Statement const& body,
+	const std::function<void()>& loopExpression
+) {
+	// Small loops are unrolled, the others run by REPEAT without a condition continuation
+	auto pushBody = [&](bool isLast) {
+		int ss = m_pusher.getStack().size();
+		body.accept(*this);
+		m_pusher.drop(m_pusher.getStack().size() - ss);
+		if (loopExpression && !isLast) {
+			loopExpression();
+		}
+	};
+
+	if (canUnroll(tripCount, body)) {
+		const int n = static_cast<int>(tripCount);
+		for (int i = 0; i < n; ++i) {
+			m_pusher.push(0, ";; iteration " + toString(i));
+			// the loop variable is dropped after the last iteration, so it isn't stepped
+			pushBody(i + 1 == n);
+		}
+	} else {
+		m_pusher.pushInt(tripCount);
+		m_pusher.push(-1, ""); // fix stack
+		m_pusher.startContinuation();
+		pushBody(false);
+		m_pusher.endContinuation();
+		m_pusher.push(0, "REPEAT");
+	}
+	m_controlFlowInfo.pop_back();
+}
+
 std::pair<ContInfo, ControlFlowInfo> TVMFunctionCompiler::pushControlFlowFlag(Statement const& body) {
 	ContInfo ci = getInfo(body);
 	ControlFlowInfo info = pushControlFlowFlagAndReturnControlFlowInfo(ci, true);
@@ -1282,6 +1494,7 @@ bool TVMFunctionCompiler::visit(ForStatement const &_forStatement) {
 	//     loopExpression
 	// }
 
+	const std::vector<std::pair<VariableDeclaration const*, bool>> cachedStateVars = pushLoopStateVariables(_forStatement);
 	int saveStackSize = m_pusher.getStack().size();
 	m_pusher.push(0, "; for");
 
@@ -1293,37 +1506,98 @@ bool TVMFunctionCompiler::visit(ForStatement const &_forStatement) {
 		haveDeclLoopVar = m_pusher.getStack().size() != saveStack;
 	}
 
-	// header
-	ContInfo ci;
-	ControlFlowInfo info;
-	std::tie(ci, info) = pushControlFlowFlag(_forStatement.body());
-
-	// condition
-	std::function<void()> pushCondition;
-	if (_forStatement.condition()) {
-		pushCondition = [&](){
-			acceptExpr(_forStatement.condition(), true);
-		};
+	// `b[i]` reads step a slice cursor together with `i` instead of walking the chain from the first cell
+	std::vector<std::pair<int, std::vector<IndexAccess const*>>> bytesCursors;
+	if (haveDeclLoopVar) {
+		for (const auto& [bytes, reads] : BytesCursorScanner{_forStatement}.cursors()) {
+			if (!m_pusher.getStack().isParam(bytes)) {
+				continue;
+			}
+			m_pusher.push(0, ";; cursor for " + bytes->name());
+			m_pusher.pushS(m_pusher.getStack().getOffset(bytes));
+			m_pusher.push(-1 + 1, "CTOS");
+			normalizeBytesCursor();
+			const int cursorPos = m_pusher.getStack().size() - 1;
+			for (IndexAccess const* read : reads) {
+				m_pusher.ctx().setBytesCursor(read, cursorPos);
+			}
+			bytesCursors.emplace_back(cursorPos, reads);
+		}
 	}
-	visitForOrWhileCondition(ci, info, pushCondition);
 
 	// body and loopExpression
 	std::function<void()> pushLoopExpression;
 	if (_forStatement.loopExpression() != nullptr) {
 		pushLoopExpression = [&]() {
 			_forStatement.loopExpression()->accept(*this);
+			for (const auto& cursor : bytesCursors) {
+				const int cursorPos = cursor.first;
+				m_pusher.pushS(m_pusher.getStack().getOffset(cursorPos)); // cursor
+				m_pusher.push(+1, "LDUQ 8"); // value cursor' -1 | cursor 0
+				m_pusher.push(-1, ""); // fix stack for if
+				m_pusher.startContinuation();
+				m_pusher.push(0, "NIP");
+				m_pusher.endContinuation();
+				m_pusher.push(0, "IF");
+				normalizeBytesCursor();
+				m_pusher.popS(m_pusher.getStack().getOffset(cursorPos));
+			}
 		};
 	}
-	visitBodyOfForLoop(ci, {}, _forStatement.body(), pushLoopExpression);
+
+	// header
+	ContInfo ci;
+	ControlFlowInfo info;
+	std::tie(ci, info) = pushControlFlowFlag(_forStatement.body());
+
+	const std::optional<bigint> tripCount =
+		haveDeclLoopVar && !ci.mayDoThat() ? constantTripCount(_forStatement) : std::nullopt;
+	if (tripCount.has_value()) {
+		// the condition is known for each iteration, so it isn't checked at runtime
+		visitBodyOfConstantLoop(*tripCount, _forStatement.body(), pushLoopExpression);
+	} else {
+		// condition
+		std::function<void()> pushCondition;
+		if (_forStatement.condition()) {
+			pushCondition = [&](){
+				acceptExpr(_forStatement.condition(), true);
+			};
+		}
+		visitForOrWhileCondition(ci, info, pushCondition);
+
+		visitBodyOfForLoop(ci, {}, _forStatement.body(), pushLoopExpression);
+	}
 
 	// bottom
-	afterLoopCheck(ci, haveDeclLoopVar);
+	for (const auto& cursor : bytesCursors) {
+		for (IndexAccess const* read : cursor.second) {
+			m_pusher.ctx().removeBytesCursor(read);
+		}
+	}
+	afterLoopCheck(ci, haveDeclLoopVar + static_cast<int>(bytesCursors.size()));
 	m_pusher.push(0, "; end for");
 	m_pusher.getStack().ensureSize(saveStackSize, "for");
+	popLoopStateVariables(cachedStateVars);
 
 	return false;
 }
 
+void TVMFunctionCompiler::normalizeBytesCursor() {
+	// stack: cursor
+	// move to the next cell once the data of the current one is read
+	m_pusher.push(+1, "DUP");
+	m_pusher.push(-1 + 2, "SBITREFS");
+	m_pusher.push(0, "SWAP");
+	m_pusher.push(0, "ISZERO");
+	m_pusher.push(-1, "AND");
+	m_pusher.push(-1, ""); // fix stack for if
+	m_pusher.startContinuation();
+	m_pusher.push(0, "PLDREF");
+	m_pusher.push(0, "CTOS");
+	m_pusher.endContinuation();
+	m_pusher.push(0, "IF");
+}
+
 bool TVMFunctionCompiler::visit(Return const &_return) {
 	m_pusher.push(0, ";; return");
 	if (!_return.names().empty()) {
@@ -1971,8 +2245,9 @@ void TVMFunctionCompiler::pushLocation(const ASTNode& node, bool reset) {
     if (!GlobalParams::g_withDebugInfo)
         return;
 
+    // only the line is needed, so there is no need to build a SourceReference with a snippet
     SourceLocation const &loc = node.location();
-    SourceReference sr = SourceReferenceExtractor::extract(&loc);
-    const int line = reset ? 0 : sr.position.line + 1;
-    m_pusher.push(0, ".loc " + sr.sourceName + ", " + toString(line));
+    const std::string sourceName = loc.source ? loc.source->name() : "";
+    const int line = reset || !loc.hasText() ? 0 : loc.source->translatePositionToLine(loc.start) + 1;
+    m_pusher.push(0, ".loc " + sourceName + ", " + toString(line));
 }
\ No newline at end of file
@@ -77,6 +77,17 @@ public:
 private:
 	void visitForOrWhileCondition(const ContInfo& ci, const ControlFlowInfo& info, const std::function<void()>& pushCondition);
 	void afterLoopCheck(const ContInfo& ci, const int& loopVarQty);
+	void normalizeBytesCursor();
+	static std::optional<bigint> constantTripCount(ForStatement const& _forStatement);
+	static bool canUnroll(const bigint& iterations, Statement const& body);
+	bool tryUnrollForEach(ForEachStatement const& _forStatement);
+	void visitBodyOfConstantLoop(
+		const bigint& tripCount,
+		Statement const& body,
+		const std::function<void()>& loopExpression
+	);
+	std::vector<std::pair<VariableDeclaration const*, bool>> pushLoopStateVariables(Statement const& _loop);
+	void popLoopStateVariables(std::vector<std::pair<VariableDeclaration const*, bool>> const& cached);
 	bool visitNode(ASTNode const&) override { solUnimplemented("Internal error: unreachable"); }
 
 	bool visit(VariableDeclarationStatement const& _variableDeclarationStatement) override;
@@ -18,7 +18,10 @@
 
 #include "TVMOptimizations.hpp"
 #include "TVMConstants.hpp"
+#include <libsolidity/interface/Version.h>
+#include <libsolutil/Keccak256.h>
 #include <boost/algorithm/string/trim.hpp>
+#include <boost/filesystem.hpp>
 #include <boost/format.hpp>
 
 namespace solidity::frontend {
@@ -1515,6 +1518,100 @@ CodeLines optimize_code(const CodeLines& code0) {
 	return code;
 }
 
+static bool hasMultilineCommand(const vector<string>& lines) {
+	return std::any_of(lines.begin(), lines.end(), [](const string& line) {
+		return line.find('\n') != string::npos;
+	});
+}
+
+OptimizedCodeCache::OptimizedCodeCache(string fileName) :
+	m_fileName{std::move(fileName)}
+{
+	// The file holds the compiler version, then every result as its key, the number
+	// of its lines and the lines themselves. Anything malformed discards the whole file.
+	try {
+		ifstream file(m_fileName);
+		string line;
+		if (!getline(file, line) || line != VersionString) {
+			return;
+		}
+		while (getline(file, line)) {
+			istringstream header(line);
+			string key;
+			string qty;
+			string rest;
+			if (!(header >> key >> qty) || header >> rest ||
+				qty.size() > 9 || !all_of(qty.begin(), qty.end(), [](unsigned char c) { return isdigit(c); })
+			) {
+				m_stored.clear();
+				return;
+			}
+			const size_t count = stoul(qty);
+			vector<string> lines;
+			while (lines.size() < count && getline(file, line)) {
+				lines.push_back(line);
+			}
+			if (lines.size() != count) {
+				m_stored.clear();
+				return;
+			}
+			m_stored.emplace(key, std::move(lines));
+		}
+	} catch (...) {
+		m_stored.clear();
+	}
+}
+
+CodeLines OptimizedCodeCache::optimize(const CodeLines& code) {
+	if (hasMultilineCommand(code.lines)) {
+		return optimize_code(code);
+	}
+	const string key = util::keccak256(code.str()).hex();
+	CodeLines result;
+	result.tabQty = code.tabQty;
+	if (auto it = m_used.find(key); it != m_used.end()) {
+		result.lines = it->second;
+	} else if (auto it = m_stored.find(key); it != m_stored.end()) {
+		result.lines = it->second;
+		m_used.emplace(key, std::move(it->second));
+		m_stored.erase(it);
+	} else {
+		result = optimize_code(code);
+		if (!hasMultilineCommand(result.lines)) {
+			m_used.emplace(key, result.lines);
+			m_changed = true;
+		}
+	}
+	return result;
+}
+
+void OptimizedCodeCache::save() const {
+	if (!m_changed && m_stored.empty()) {
+		return;
+	}
+	// Several compilers may share the file, so it is replaced at once.
+	namespace fs = boost::filesystem;
+	boost::system::error_code ec;
+	const fs::path tmp = fs::path(m_fileName).parent_path() / fs::unique_path("%%%%%%%%.tmp", ec);
+	if (ec) {
+		return;
+	}
+	{
+		ofstream file(tmp.string());
+		file << VersionString << '\n';
+		for (const auto& [key, lines] : m_used) {
+			file << key << ' ' << lines.size() << '\n';
+			for (const string& line : lines) {
+				file << line << '\n';
+			}
+		}
+	}
+	fs::rename(tmp, m_fileName, ec);
+	if (ec) {
+		fs::remove(tmp, ec);
+	}
+}
+
 void run_peephole_pass(const string& filename) {
 	ifstream file(filename);
 	string line;
@@ -23,6 +23,22 @@
 namespace solidity::frontend {
 
 	CodeLines optimize_code(const CodeLines&);
+
+	// Results of optimize_code kept in a file between compilations. The result depends on
+	// nothing but the code, so it is looked up by the hash of the code.
+	class OptimizedCodeCache {
+	public:
+		// Loads the results stored in fileName, if there are any for this compiler version
+		explicit OptimizedCodeCache(string fileName);
+		CodeLines optimize(const CodeLines& code);
+		// Stores the results used since loading and drops all others
+		void save() const;
+	private:
+		string m_fileName;
+		map<string, vector<string>> m_stored;
+		map<string, vector<string>> m_used;
+		bool m_changed{};
+	};
 	
 	void run_peephole_pass(const string& filename);
 
@@ -1654,7 +1654,7 @@ void StackPusherHelper::prepareKeyForDictOperations(Type const *key, bool doIgno
 }
 
 int StackPusherHelper::int_msg_info(const std::set<int> &isParamOnStack, const std::map<int, std::string> &constParams,
-									bool isDestBuilder) {
+									bool isDestBuilder, std::string& tailBits) {
 	// int_msg_info$0  ihr_disabled:Bool  bounce:Bool(#1)  bounced:Bool
 	//                 src:MsgAddress  dest:MsgAddressInt(#4)
 	//                 value:CurrencyCollection(#5,#6)  ihr_fee:Grams  fwd_fee:Grams
@@ -1710,12 +1710,12 @@ int StackPusherHelper::int_msg_info(const std::set<int> &isParamOnStack, const s
 			}
 		}
 	}
-	appendToBuilder(bitString);
-	bitString = "";
+	// constant tail is stored by caller together with the following flags
+	tailBits = bitString;
 	return maxBitStringSize;
 }
 
-int StackPusherHelper::ext_msg_info(const set<int> &isParamOnStack, bool isOut = true) {
+int StackPusherHelper::ext_msg_info(const set<int> &isParamOnStack, bool isOut, std::string& tailBits) {
 	// ext_in_msg_info$10 src:MsgAddressExt dest:MsgAddressInt
 	// import_fee:Grams = CommonMsgInfo;
 	//
@@ -1751,27 +1751,29 @@ int StackPusherHelper::ext_msg_info(const set<int> &isParamOnStack, bool isOut =
 		}
 	}
 	maxBitStringSize += bitString.size();
-	appendToBuilder(bitString);
-	bitString = "";
+	// constant tail is stored by caller together with the following flags
+	tailBits = bitString;
 	return maxBitStringSize;
 }
 
 
 void StackPusherHelper::appendToBuilder(const std::string &bitString) {
 	// stack: builder
-	if (bitString.empty()) {
-		return;
-	}
-
-	size_t count = std::count_if(bitString.begin(), bitString.end(), [](char c) { return c == '0'; });
-	if (count == bitString.size()) {
-		stzeroes(count);
-	} else {
-		const std::string hex = binaryStringToSlice(bitString);
-		if (hex.length() * 4 <= 8 * 7 + 1) {
+	// Zeroes up to this length are cheaper as one STSLICECONST than as PUSHINT + STZEROES
+	const int maxZeroesInSTSLICECONST = 25;
+	for (int i = 0; i < static_cast<int>(bitString.size()); i += TvmConst::MaxPushSliceBitLength) {
+		const std::string chunk = bitString.substr(i, TvmConst::MaxPushSliceBitLength);
+		const int chunkLength = chunk.size();
+		const bool isZeroes = std::all_of(chunk.begin(), chunk.end(), [](char c) { return c == '0'; });
+		if (isZeroes && (chunkLength == 1 || chunkLength > maxZeroesInSTSLICECONST)) {
+			stzeroes(chunkLength);
+			continue;
+		}
+		const std::string hex = binaryStringToSlice(chunk);
+		if (hex.length() * 4 <= TvmConst::MaxSTSLICECONST + 1) {
 			push(0, "STSLICECONST x" + hex);
 		} else {
-			push(+1, "PUSHSLICE x" + binaryStringToSlice(bitString));
+			push(+1, "PUSHSLICE x" + hex);
 			push(-1, "STSLICER");
 		}
 	}
@@ -1833,37 +1835,41 @@ void StackPusherHelper::prepareMsg(
 	bool isDestBuilder
 ) {
 	int msgInfoSize = 0;
+	// constant bits that are not stored yet. They are folded with the StateInit and body flags below.
+	std::string bitString;
 	switch (messageType) {
 		case MsgType::Internal:
-			msgInfoSize = int_msg_info(isParamOnStack, constParams, isDestBuilder);
+			msgInfoSize = int_msg_info(isParamOnStack, constParams, isDestBuilder, bitString);
 			break;
 		case MsgType::ExternalOut:
-			msgInfoSize = ext_msg_info(isParamOnStack);
+			msgInfoSize = ext_msg_info(isParamOnStack, true, bitString);
 			break;
 		case MsgType::ExternalIn:
-			msgInfoSize = ext_msg_info(isParamOnStack, false);
+			msgInfoSize = ext_msg_info(isParamOnStack, false, bitString);
 			break;
 	}
 	// stack: builder
 
 	if (appendStateInit) {
 		// stack: values... builder
-		appendToBuilder("1");
+		appendToBuilder(bitString + "1");
+		bitString = "";
 		appendStateInit();
 		++msgInfoSize;
 		// stack: builder-with-stateInit
 	} else {
-		appendToBuilder("0"); // there is no StateInit
+		bitString += "0"; // there is no StateInit
 	}
 
 	++msgInfoSize;
 
 	if (appendBody) {
 		// stack: values... builder
+		appendToBuilder(bitString);
 		appendBody(msgInfoSize);
 		// stack: builder-with-body
 	} else {
-		appendToBuilder("0"); // there is no body
+		appendToBuilder(bitString + "0"); // there is no body
 	}
 
 	// stack: builder'
@@ -1912,6 +1918,10 @@ void TVMStack::add(Declaration const *name, bool doAllocation) {
     m_stackSize.at(m_size - 1) = name;
 }
 
+void TVMStack::remove(Declaration const *name) {
+	std::replace(m_stackSize.begin(), m_stackSize.end(), name, static_cast<Declaration const*>(nullptr));
+}
+
 int TVMStack::getOffset(Declaration const *name) const {
 	solAssert(isParam(name), "");
 	int stackSize = getStackSize(name);
@@ -2024,11 +2034,89 @@ void TVMCompilerContext::initMembers(ContractDefinition const *contract) {
     }
 
 	ignoreIntOverflow = m_pragmaHelper.haveIgnoreIntOverflow();
-	for (VariableDeclaration const *variable: notConstantStateVariables()) {
+	m_c4StateVariables = notConstantStateVariables();
+	if (m_pragmaHelper.haveOptimizeStorage()) {
+		m_c4StateVariables = optimizeStorageLayout(m_c4StateVariables);
+	}
+	// c4_to_c7 and c7_to_c4 rely on the global index following the order in c4
+	for (VariableDeclaration const *variable: m_c4StateVariables) {
 		m_stateVarIndex[variable] = TvmConst::C7::FirstIndexForVariables + m_stateVarIndex.size();
 	}
 }
 
+std::vector<VariableDeclaration const *>
+TVMCompilerContext::optimizeStorageLayout(std::vector<VariableDeclaration const *> variables) const {
+	// State variables are stored in a chain of cells and all of them are loaded on each call,
+	// so the layout is good when the chain is short. Pack variables into cells with
+	// first fit decreasing and keep the declaration order if it is not worse.
+	struct Item {
+		VariableDeclaration const* variable{};
+		int bits{};
+		int refs{};
+	};
+	std::function<void(Type const*, Item&)> addSize = [&](Type const* type, Item& item) {
+		if (auto structType = to<StructType>(type)) {
+			for (const ASTPointer<VariableDeclaration>& m : structType->structDefinition().members()) {
+				addSize(m->type(), item);
+			}
+		} else {
+			ABITypeSize size{type};
+			item.bits += size.maxBits;
+			item.refs += size.maxRefs;
+		}
+	};
+	std::vector<Item> items;
+	for (VariableDeclaration const* v : variables) {
+		Item item{v};
+		addSize(v->type(), item);
+		items.push_back(item);
+	}
+	std::stable_sort(items.begin(), items.end(), [](const Item& a, const Item& b) {
+		return std::make_pair(a.bits, a.refs) > std::make_pair(b.bits, b.refs);
+	});
+
+	struct Cell {
+		int restBits{};
+		int restRefs{};
+		std::vector<VariableDeclaration const*> variables;
+	};
+	// one ref of each cell is reserved for the next cell of the chain
+	std::vector<Cell> cells{{TvmConst::CellBitLength - getOffsetC4(), 3, {}}};
+	for (const Item& item : items) {
+		auto cell = std::find_if(cells.begin(), cells.end(), [&](const Cell& c) {
+			return item.bits <= c.restBits && item.refs <= c.restRefs;
+		});
+		if (cell == cells.end()) {
+			cells.push_back({TvmConst::CellBitLength, 3, {}});
+			cell = std::prev(cells.end());
+		}
+		cell->restBits -= item.bits;
+		cell->restRefs -= item.refs;
+		cell->variables.push_back(item.variable);
+	}
+
+	std::vector<VariableDeclaration const *> packed;
+	for (const Cell& cell : cells) {
+		packed.insert(packed.end(), cell.variables.begin(), cell.variables.end());
+	}
+
+	auto qtyOfCells = [&](const std::vector<VariableDeclaration const *>& order) {
+		std::vector<Type const*> types;
+		for (VariableDeclaration const* v : order) {
+			types.push_back(v->type());
+		}
+		return EncodePosition{getOffsetC4(), types}.countOfCreatedBuilders();
+	};
+	if (qtyOfCells(packed) < qtyOfCells(variables)) {
+		return packed;
+	}
+	return variables;
+}
+
+std::vector<VariableDeclaration const *> const& TVMCompilerContext::c4StateVariables() const {
+	return m_c4StateVariables;
+}
+
 TVMCompilerContext::TVMCompilerContext(ContractDefinition const *contract,
 									   PragmaDirectiveHelper const &pragmaHelper) : m_pragmaHelper{pragmaHelper} {
 	initMembers(contract);
@@ -2053,7 +2141,7 @@ std::vector<VariableDeclaration const *> TVMCompilerContext::notConstantStateVar
 
 std::vector<Type const *> TVMCompilerContext::notConstantStateVariableTypes() const {
 	std::vector<Type const *> types;
-	for (VariableDeclaration const * var : notConstantStateVariables()) {
+	for (VariableDeclaration const * var : c4StateVariables()) {
 		types.emplace_back(var->type());
 	}
 	return types;
@@ -2061,7 +2149,7 @@ std::vector<Type const *> TVMCompilerContext::notConstantStateVariableTypes() co
 
 std::vector<std::string> TVMCompilerContext::notConstantStateVariableNames() const {
 	std::vector<std::string> names;
-	for (VariableDeclaration const * var : notConstantStateVariables()) {
+	for (VariableDeclaration const * var : c4StateVariables()) {
 		names.emplace_back(var->name());
 	}
 	return names;
@@ -2215,6 +2303,20 @@ bool TVMCompilerContext::getSaveMyCodeSelector() {
 	return saveMyCodeSelector;
 }
 
+std::optional<int> TVMCompilerContext::bytesCursor(IndexAccess const* _node) const {
+	auto it = m_bytesCursors.find(_node);
+	if (it == m_bytesCursors.end())
+		return {};
+	return it->second;
+}
+
+std::optional<int> TVMCompilerContext::cachedValue(Expression const* _node) const {
+	auto it = m_cachedValues.find(_node);
+	if (it == m_cachedValues.end())
+		return {};
+	return it->second;
+}
+
 bool TVMCompilerContext::dfs(FunctionDefinition const* v) {
 	if (color.at(v) == Color::Black) {
 		return false;
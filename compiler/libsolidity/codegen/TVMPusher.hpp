@@ -45,6 +45,7 @@ public:
 	void change(int diff);
 	bool isParam(Declaration const* name) const;
 	void add(Declaration const* name, bool doAllocation);
+	void remove(Declaration const* name);
 	int getOffset(Declaration const* name) const;
 	int getOffset(int stackPos) const;
 	int getStackSize(Declaration const* name) const;
@@ -75,6 +76,7 @@ public:
 	void initMembers(ContractDefinition const* contract);
 	int getStateVarIndex(VariableDeclaration const *variable) const;
 	std::vector<VariableDeclaration const *> notConstantStateVariables() const;
+	std::vector<VariableDeclaration const *> const& c4StateVariables() const;
 	std::vector<Type const *> notConstantStateVariableTypes() const;
 	std::vector<std::string> notConstantStateVariableNames() const;
 	PragmaDirectiveHelper const& pragmaHelper() const;
@@ -109,12 +111,21 @@ public:
 	bool isBaseFunction(CallableDeclaration const* d) const;
 	void setSaveMyCodeSelector();
 	bool getSaveMyCodeSelector();
+	void setBytesCursor(IndexAccess const* _node, int stackPos) { m_bytesCursors[_node] = stackPos; }
+	void removeBytesCursor(IndexAccess const* _node) { m_bytesCursors.erase(_node); }
+	std::optional<int> bytesCursor(IndexAccess const* _node) const;
+	void setCachedValue(Expression const* _node, int stackPos) { m_cachedValues[_node] = stackPos; }
+	void removeCachedValue(Expression const* _node) { m_cachedValues.erase(_node); }
+	std::optional<int> cachedValue(Expression const* _node) const;
 
 private:
+	std::vector<VariableDeclaration const *> optimizeStorageLayout(std::vector<VariableDeclaration const *> variables) const;
+
 	ContractDefinition const* m_contract{};
 	bool ignoreIntOverflow{};
 	PragmaDirectiveHelper const& m_pragmaHelper;
 	std::map<VariableDeclaration const*, int> m_stateVarIndex;
+	std::vector<VariableDeclaration const*> m_c4StateVariables;
 	std::set<FunctionDefinition const*> m_libFunctions;
 	FunctionDefinition const* m_currentFunction{};
 	std::map<std::string, CodeLines> m_inlinedFunctions;
@@ -129,6 +140,8 @@ private:
 	bool m_isOnBounceGenerated{};
     std::set<CallableDeclaration const*> m_baseFunctions;
     bool saveMyCodeSelector{};
+	std::map<IndexAccess const*, int> m_bytesCursors;
+	std::map<Expression const*, int> m_cachedValues;
 };
 
 class StackPusherHelper {
@@ -223,9 +236,10 @@ public:
 	void exchange(int i, int j);
 	void prepareKeyForDictOperations(Type const* key, bool doIgnoreBytes);
 	[[nodiscard]]
-	int int_msg_info(const std::set<int> &isParamOnStack, const std::map<int, std::string> &constParams, bool isDestBuilder);
+	int int_msg_info(const std::set<int> &isParamOnStack, const std::map<int, std::string> &constParams, bool isDestBuilder,
+					 std::string& tailBits);
 	[[nodiscard]]
-	int ext_msg_info(const std::set<int> &isParamOnStack, bool isOut);
+	int ext_msg_info(const std::set<int> &isParamOnStack, bool isOut, std::string& tailBits);
 	void appendToBuilder(const std::string& bitString);
 	void checkOptionalValue();
 	bool doesFitInOneCellAndHaveNoStruct(Type const* key, Type const* value);
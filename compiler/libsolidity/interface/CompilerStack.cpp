@@ -54,6 +54,9 @@
 #include <json/json.h>
 #include <boost/algorithm/string.hpp>
 
+#include <atomic>
+#include <thread>
+
 #include <libsolidity/codegen/TVM.h>
 #include <libsolidity/codegen/TVMTypeChecker.hpp>
 #include <libsolidity/codegen/TVMAnalyzer.hpp>
@@ -72,12 +75,23 @@ static int g_compilerStackCounts = 0;
 
 #include <stdlib.h>
 
+namespace
+{
+
+bool curlFetch(string const& _url, string const& _destination)
+{
+	return system((string("curl -f -L ") + _url + " -o " + _destination).c_str()) == 0;
+}
+
+}
+
 CompilerStack::CompilerStack(ReadCallback::Callback const& _readFile):
 	m_readFile{_readFile},
 	m_generateIR{false},
 	m_generateEwasm{false},
 	m_errorList{},
-	m_errorReporter{m_errorList}
+	m_errorReporter{m_errorList},
+	m_remoteFetcher{curlFetch}
 {
 	// Because TypeProvider is currently a singleton API, we must ensure that
 	// no more than one entity is actually using it at a time.
@@ -201,7 +215,7 @@ void CompilerStack::setSources(StringMap _sources)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Cannot change sources once set."));
 	if (m_stackState != Empty)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set sources before parsing."));
-	for (auto source: _sources)
+	for (auto& source: _sources)
 		m_sources[source.first].scanner = make_shared<Scanner>(CharStream(/*content*/std::move(source.second), /*name*/source.first));
 	m_stackState = SourcesSet;
 }
@@ -212,6 +226,7 @@ bool CompilerStack::parse()
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must call parse only after the SourcesSet state."));
 	m_errorReporter.clear();
 
+	// Sources are parsed one by one: the node IDs come from the counter of this single parser.
 	Parser parser{m_errorReporter, m_evmVersion, m_parserErrorRecovery};
 	vector<string> sourcesToParse;
 	for (auto const& s: m_sources)
@@ -221,7 +236,10 @@ bool CompilerStack::parse()
 		string const& path = sourcesToParse[i];
 		Source& source = m_sources[path];
 		source.scanner->reset();
-		source.ast = parser.parse(source.scanner);
+		// one arena per source unit, sized for a small contract; it grows geometrically
+		source.ast.reset();
+		source.arena = make_shared<pmr::monotonic_buffer_resource>(64 * 1024);
+		source.ast = parser.parse(source.scanner, source.arena.get());
 		if (!source.ast)
 			solAssert(!Error::containsOnlyWarnings(m_errorReporter.errors()), "Parser returned null but did not report error.");
 		else
@@ -232,11 +250,10 @@ bool CompilerStack::parse()
 				absPath = path;
 			else
 				absPath = boost::filesystem::canonical(path).string();
-			for (auto const& newSource: loadMissingSources(*source.ast, absPath))
+			for (auto& newSource: loadMissingSources(*source.ast, absPath))
 			{
 				string const& newPath = newSource.first;
-				string const& newContents = newSource.second;
-				m_sources[newPath].scanner = make_shared<Scanner>(CharStream(newContents, newPath));
+				m_sources[newPath].scanner = make_shared<Scanner>(CharStream(std::move(newSource.second), newPath));
 				sourcesToParse.push_back(newPath);
 			}
 		}
@@ -260,7 +277,7 @@ void CompilerStack::importASTs(map<string, Json::Value> const& _sources)
 		Source source;
 		source.ast = src.second;
 		string srcString = util::jsonCompactPrint(m_sourceJsons[src.first]);
-		ASTPointer<Scanner> scanner = make_shared<Scanner>(langutil::CharStream(srcString, src.first));
+		ASTPointer<Scanner> scanner = make_shared<Scanner>(langutil::CharStream(std::move(srcString), src.first));
 		source.scanner = scanner;
 		m_sources[path] = source;
 	}
@@ -575,6 +592,7 @@ std::pair<bool, bool> CompilerStack::compile()
 				m_inputFile,
 				m_folder,
 				m_file_prefix,
+				m_optimizerCacheFolder,
 				m_doPrintFunctionIds
 			);
 			didCompileSomething = true;
@@ -866,9 +884,73 @@ string const& CompilerStack::Source::ipfsUrl() const
 	return ipfsUrlCached;
 }
 
+CompilerStack::RemoteFetcher CompilerStack::localDirectoryFetcher(string _directory)
+{
+	return [directory = std::move(_directory)](string const& _url, string const& _destination) {
+		boost::system::error_code ec;
+		boost::filesystem::copy_file(
+			boost::filesystem::path(directory) / boost::filesystem::path(_url).filename(),
+			_destination,
+			boost::filesystem::copy_option::overwrite_if_exists,
+			ec
+		);
+		return !ec;
+	};
+}
+
+map<string, bool> CompilerStack::fetchRemoteImports(SourceUnit const& _ast, string const& _sourcePath)
+{
+	boost::filesystem::path imp = boost::filesystem::path(_sourcePath).remove_filename() / ".solc_imports";
+	// url and destination of every remote import that is not downloaded yet;
+	// imports with the same file name share the destination, the first one wins
+	vector<pair<string, string>> downloads;
+	set<string> destinations;
+	for (auto const& node: _ast.nodes())
+		if (auto import = dynamic_cast<ImportDirective const*>(node.get()))
+		{
+			string const& url = import->path();
+			if (url.find("http") == string::npos)
+				continue;
+			string destination = (imp / boost::filesystem::path(url).filename()).string();
+			if ((!boost::filesystem::exists(destination) || m_forceUpdate) && destinations.insert(destination).second)
+				downloads.emplace_back(url, destination);
+		}
+
+	map<string, bool> fetched;
+	if (downloads.empty())
+		return fetched;
+	boost::system::error_code ec;
+	boost::filesystem::create_directory(imp, ec);
+	if (ec)
+		// loadMissingSources reports that the directory cannot be created
+		return fetched;
+
+	// Every download mostly waits for the network, so more of them run at once than
+	// there are cores, but no more than a few to spare the server and the process table.
+	size_t const maxDownloadThreads = 8;
+	vector<char> results(downloads.size(), false);
+	atomic<size_t> nextDownload{0};
+	auto worker = [&]() {
+		for (size_t i = nextDownload++; i < downloads.size(); i = nextDownload++)
+			results[i] = m_remoteFetcher(downloads[i].first, downloads[i].second);
+	};
+
+	size_t const threadQty = min(maxDownloadThreads, downloads.size());
+	vector<thread> threads;
+	for (size_t i = 1; i < threadQty; ++i)
+		threads.emplace_back(worker);
+	worker();
+	for (thread& t: threads)
+		t.join();
+	for (size_t i = 0; i < downloads.size(); ++i)
+		fetched[downloads[i].first] = results[i];
+	return fetched;
+}
+
 StringMap CompilerStack::loadMissingSources(SourceUnit const& _ast, std::string const& _sourcePath)
 {
 	solAssert(m_stackState < ParsingPerformed, "");
+	map<string, bool> const fetched = fetchRemoteImports(_ast, _sourcePath);
 	StringMap newSources;
 	for (auto const& node: _ast.nodes())
 		if (ImportDirective const* import = dynamic_cast<ImportDirective*>(node.get()))
@@ -891,16 +973,14 @@ StringMap CompilerStack::loadMissingSources(SourceUnit const& _ast, std::string
 					}
 				}
 				imp_path = imp / imp_path.filename();
-				if (!boost::filesystem::exists(imp_path) || m_forceUpdate) {
-					int ec = system((string("curl -f -L ") + import_path + " -o " + imp_path.string()).c_str());
-					if (ec != 0) {
-						boost::filesystem::remove(imp_path);
-						m_errorReporter.parserError(
-								import->location(),
-								string("Failed to fetch import file: \"" + import_path)
-						);
-						continue;
-					}
+				auto fetch = fetched.find(import_path);
+				if (fetch != fetched.end() && !fetch->second) {
+					boost::filesystem::remove(imp_path);
+					m_errorReporter.parserError(
+							import->location(),
+							string("Failed to fetch import file: \"" + import_path)
+					);
+					continue;
 				}
 				import_path = imp_path.string();
 			} else {
@@ -932,7 +1012,7 @@ StringMap CompilerStack::loadMissingSources(SourceUnit const& _ast, std::string
 				result = m_readFile(ReadCallback::kindString(ReadCallback::Kind::ReadFile), importPath);
 			}
 			if (result.success)
-				newSources[importPath] = result.responseOrErrorMessage;
+				newSources[importPath] = std::move(result.responseOrErrorMessage);
 			else
 			{
 				m_errorReporter.parserError(
@@ -40,6 +40,7 @@
 
 #include <functional>
 #include <memory>
+#include <memory_resource>
 #include <ostream>
 #include <set>
 #include <string>
@@ -171,6 +172,19 @@ public:
 		m_forceUpdate = _forceUpdate;
 	}
 
+	/// Downloads the remote import @a _url into the file @a _destination.
+	/// @returns false on failure. Has to be safe to call from several threads at once.
+	using RemoteFetcher = std::function<bool(std::string const& _url, std::string const& _destination)>;
+
+	/// Sets the fetcher used for remote (http) imports. Defaults to curl.
+	void setRemoteFetcher(RemoteFetcher _fetcher) {
+		m_remoteFetcher = std::move(_fetcher);
+	}
+
+	/// @returns a fetcher that takes the remote imports from the local directory @a _directory
+	/// by their file name instead of downloading them.
+	static RemoteFetcher localDirectoryFetcher(std::string _directory);
+
 	void setMainContract(std::string mainContract) {
 		m_mainContract = mainContract;
 	}
@@ -200,6 +214,11 @@ public:
 		m_file_prefix = file_prefix;
 	}
 
+	/// Sets the folder where the optimized code of every function is kept between compilations.
+	void setOptimizerCacheFolder(const std::string& folder) {
+		m_optimizerCacheFolder = folder;
+	}
+
 	void setInputFile(const std::string& inputFile) {
 		m_inputFile = inputFile;
 	}
@@ -341,11 +360,13 @@ private:
 	struct Source
 	{
 		std::shared_ptr<langutil::Scanner> scanner;
+		/// Memory of the parsed nodes of ast; declared before it, so it is destroyed after it
+		std::shared_ptr<std::pmr::monotonic_buffer_resource> arena;
 		std::shared_ptr<SourceUnit> ast;
 		util::h256 mutable keccak256HashCached;
 		util::h256 mutable swarmHashCached;
 		std::string mutable ipfsUrlCached;
-		void reset() { *this = Source(); }
+		void reset() { ast.reset(); *this = Source(); }
 		util::h256 const& keccak256() const;
 		util::h256 const& swarmHash() const;
 		std::string const& ipfsUrl() const;
@@ -372,6 +393,9 @@ private:
 	/// @a m_readFile and stores the absolute paths of all imports in the AST annotations.
 	/// @returns the newly loaded sources.
 	StringMap loadMissingSources(SourceUnit const& _ast, std::string const& _path);
+	/// Downloads the remote imports of @a _ast (named @a _path) on up to eight threads.
+	/// @returns the urls that have been fetched mapped to whether fetching succeeded.
+	std::map<std::string, bool> fetchRemoteImports(SourceUnit const& _ast, std::string const& _path);
 	std::string applyRemapping(std::string const& _path, std::string const& _context);
 	void resolveImports();
 
@@ -489,8 +513,10 @@ private:
 	bool m_withDebugInfo{};
 	std::string m_folder;
 	std::string m_file_prefix;
+	std::string m_optimizerCacheFolder;
 	std::string m_inputFile;
 	bool m_forceUpdate = false;
+	RemoteFetcher m_remoteFetcher;
 	bool m_doPrintFunctionIds = false;
 };
 
@@ -38,6 +38,32 @@ using namespace solidity::langutil;
 namespace solidity::frontend
 {
 
+/// Allocates AST nodes together with their control blocks from the arena passed to parse().
+/// The arena is owned by the caller and released in bulk after the nodes are destroyed.
+template <class T>
+class Parser::ArenaAllocator
+{
+public:
+	using value_type = T;
+
+	explicit ArenaAllocator(pmr::memory_resource* _arena): m_arena(_arena) {}
+	template <class U>
+	ArenaAllocator(ArenaAllocator<U> const& _other): m_arena(_other.m_arena) {}
+
+	T* allocate(size_t _n) { return static_cast<T*>(m_arena->allocate(_n * sizeof(T), alignof(T))); }
+	void deallocate(T* _p, size_t _n) { m_arena->deallocate(_p, _n * sizeof(T), alignof(T)); }
+
+	template <class U>
+	bool operator==(ArenaAllocator<U> const& _other) const { return m_arena == _other.m_arena; }
+	template <class U>
+	bool operator!=(ArenaAllocator<U> const& _other) const { return m_arena != _other.m_arena; }
+
+private:
+	template <class U> friend class ArenaAllocator;
+
+	pmr::memory_resource* m_arena;
+};
+
 /// AST node factory that also tracks the begin and end position of an AST node
 /// while it is being parsed
 class Parser::ASTNodeFactory
@@ -60,7 +86,14 @@ public:
 		solAssert(m_location.source, "");
 		if (m_location.end < 0)
 			markEndPosition();
-		return make_shared<NodeType>(m_parser.nextID(), m_location, std::forward<Args>(_args)...);
+		if (!m_parser.m_arena)
+			return make_shared<NodeType>(m_parser.nextID(), m_location, std::forward<Args>(_args)...);
+		return allocate_shared<NodeType>(
+			ArenaAllocator<NodeType>{m_parser.m_arena},
+			m_parser.nextID(),
+			m_location,
+			std::forward<Args>(_args)...
+		);
 	}
 
 	SourceLocation const& location() const noexcept { return m_location; }
@@ -70,13 +103,14 @@ private:
 	SourceLocation m_location;
 };
 
-ASTPointer<SourceUnit> Parser::parse(shared_ptr<Scanner> const& _scanner)
+ASTPointer<SourceUnit> Parser::parse(shared_ptr<Scanner> const& _scanner, pmr::memory_resource* _arena)
 {
 	solAssert(!m_insideModifier, "");
 	try
 	{
 		m_recursionDepth = 0;
 		m_scanner = _scanner;
+		m_arena = _arena;
 		ASTNodeFactory nodeFactory(*this);
 		vector<ASTPointer<ASTNode>> nodes;
 		while (m_scanner->currentToken() != Token::EOS)
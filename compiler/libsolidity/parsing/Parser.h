@@ -26,6 +26,8 @@
 #include <liblangutil/ParserBase.h>
 #include <liblangutil/EVMVersion.h>
 
+#include <memory_resource>
+
 namespace solidity::langutil
 {
 class Scanner;
@@ -46,10 +48,15 @@ public:
 		m_evmVersion(_evmVersion)
 	{}
 
-	ASTPointer<SourceUnit> parse(std::shared_ptr<langutil::Scanner> const& _scanner);
+	/// Allocates the nodes from @a _arena if it is given. The arena has to outlive the nodes.
+	ASTPointer<SourceUnit> parse(
+		std::shared_ptr<langutil::Scanner> const& _scanner,
+		std::pmr::memory_resource* _arena = nullptr
+	);
 
 private:
 	class ASTNodeFactory;
+	template <class T> class ArenaAllocator;
 
 	struct VarDeclParserOptions
 	{
@@ -208,6 +215,8 @@ private:
 	/// Creates an empty ParameterList at the current location (used if parameters can be omitted).
 	ASTPointer<ParameterList> createEmptyParameterList();
 
+	/// Allocator for the nodes of the source unit being parsed, or nullptr for the heap
+	std::pmr::memory_resource* m_arena = nullptr;
 	/// Flag that signifies whether '_' is parsed as a PlaceholderStatement or a regular identifier.
 	bool m_insideModifier = false;
 	langutil::EVMVersion m_evmVersion;
@@ -124,6 +124,8 @@ static string const g_argTvmABI = "tvm-abi";
 static string const g_argTvmOptimize = "tvm-optimize";
 static string const g_argTvmPeephole = "tvm-peephole";
 static string const g_argRefreshRemote = "tvm-refresh-remote";
+static string const g_argRemoteDir = "tvm-remote-dir";
+static string const g_argTvmCacheDir = "tvm-cache-dir";
 static string const g_argTvmUnsavedStructs = "tvm-unsaved-structs";
 static string const g_argFunctionIds = "function-ids";
 
@@ -286,6 +288,16 @@ Allowed options)",
 			po::value<string>()->value_name("prefixName"),
 			"Set prefix of names of output files (*.code and *abi.json)."
 		)
+		(
+			g_argRemoteDir.c_str(),
+			po::value<string>()->value_name("path/to/dir"),
+			"Take remote import files from the directory instead of downloading them."
+		)
+		(
+			g_argTvmCacheDir.c_str(),
+			po::value<string>()->value_name("path/to/dir"),
+			"Reuse the optimized code of unchanged functions from the directory and store new results there."
+		)
 		;
 	po::options_description outputComponents("Output Components");
 	outputComponents.add_options()
@@ -392,7 +404,7 @@ bool CommandLineInterface::processInput()
 
 			auto contents = readFileAsString(canonicalPath.string());
 			m_sourceCodes[path.generic_string()] = contents;
-			return ReadCallback::Result{true, contents};
+			return ReadCallback::Result{true, std::move(contents)};
 		}
 		catch (Exception const& _exception)
 		{
@@ -424,6 +436,9 @@ bool CommandLineInterface::processInput()
 		if (m_args.count(g_argRefreshRemote))
 		    m_compiler->setForceUpdate(true);
 
+		if (m_args.count(g_argRemoteDir))
+			m_compiler->setRemoteFetcher(CompilerStack::localDirectoryFetcher(m_args[g_argRemoteDir].as<string>()));
+
 		if (m_args.count(g_argSetContract))
 			m_compiler->setMainContract(m_args[g_argSetContract].as<string>());
 
@@ -433,6 +448,9 @@ bool CommandLineInterface::processInput()
 		if (m_args.count(g_argFile))
 			m_compiler->setFileNamePrefix(m_args[g_argFile].as<string>());
 
+		if (m_args.count(g_argTvmCacheDir))
+			m_compiler->setOptimizerCacheFolder(m_args[g_argTvmCacheDir].as<string>());
+
 		if (m_args.count(g_argTvmABI))
 			m_compiler->generateAbi();
 		if (m_args.count(g_argTvm))
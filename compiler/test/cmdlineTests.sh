@@ -381,6 +381,113 @@ SOLTMPDIR=$(mktemp -d)
 )
 rm -rf "$SOLTMPDIR"
 
+printTask "Testing calls of hand-written stdlib routines..."
+SOLTMPDIR=$(mktemp -d)
+(
+    set -e
+    cd "$SOLTMPDIR"
+    echo 'pragma ton-solidity >= 0.35.0;
+contract C {
+    function pow(uint a, uint n) public pure returns (uint) { return a ** n; }
+    function less(string a, string b) public pure returns (bool) { return a < b; }
+    function equal(string a, string b) public pure returns (bool) { return a == b; }
+    function cat(string a, string b) public pure returns (string) { return a + b; }
+    function app(string a, string b) public pure returns (string) { a.append(b); return a; }
+}' > k.sol
+    "$SOLC" k.sol >/dev/null
+    function body() { awk "/^\.macro ${1}_internal_macro/,/^; end function ${1}\$/" k.code; }
+    body pow | grep -q 'CALL \$__exp_macro\$'
+    body less | grep -q 'CALL \$compareLongStrings_macro\$'
+    body equal | grep -q 'CALL \$equalStrings_macro\$'
+    body cat | grep -q 'CALL \$concatenateStrings_macro\$'
+    body app | grep -q 'CALL \$concatenateStrings_macro\$'
+)
+rm -rf "$SOLTMPDIR"
+
+printTask "Testing loop lowering..."
+SOLTMPDIR=$(mktemp -d)
+(
+    set -e
+    cd "$SOLTMPDIR"
+    echo 'pragma ton-solidity >= 0.35.0;
+contract C {
+    function unrolled() public pure returns (uint s) { for (uint i = 0; i < 4; i++) { s += i; } }
+    function counted() public pure returns (uint s) { for (uint i = 0; i < 100; i++) { s += i; } }
+    function repeated(uint n) public pure returns (uint s) { repeat(50) { s += n; } }
+    function each() public pure returns (uint s) { for (uint x : [uint(1), 2, 3]) { s += x; } }
+    function cursor(bytes b) public pure returns (uint s) { for (uint i = 0; i < b.length; i++) { s += uint8(b[i]); } }
+}' > l.sol
+    "$SOLC" l.sol >/dev/null
+    function body() { awk "/^\.macro ${1}_internal_macro/,/^; end function ${1}\$/" l.code; }
+    # small constant loops are straight-line code
+    body unrolled | grep -q ADD
+    body each | grep -q ADD
+    if body unrolled | grep -qE 'PUSHCONT|WHILE|REPEAT'; then exit 1; fi
+    if body each | grep -qE 'PUSHCONT|WHILE|REPEAT|DICT'; then exit 1; fi
+    # larger constant loops run under REPEAT without a condition
+    body counted | grep -q REPEAT
+    if body counted | grep -q WHILE; then exit 1; fi
+    body repeated | grep -q REPEAT
+    if body repeated | grep -q WHILE; then exit 1; fi
+    # b[i] in a counting loop steps a slice cursor
+    body cursor | grep -q 'LDUQ 8'
+)
+rm -rf "$SOLTMPDIR"
+
+printTask "Testing the optimizer cache..."
+SOLTMPDIR=$(mktemp -d)
+(
+    set -e
+    cd "$SOLTMPDIR"
+    echo 'pragma ton-solidity >= 0.35.0; contract C { function f(uint a) public pure returns (uint) { return a + 1; } }' > c.sol
+    "$SOLC" c.sol >/dev/null
+    mv c.code expected.code
+    mkdir cache
+    # A cold run fills the cache
+    "$SOLC" c.sol --tvm-cache-dir cache >/dev/null
+    test -s cache/C.optcache
+    cmp c.code expected.code
+    # A warm run takes the code from it
+    "$SOLC" c.sol --tvm-cache-dir cache >/dev/null
+    cmp c.code expected.code
+    # A corrupted cache is ignored and rewritten
+    for qty in -5 99999999999999999 x 3
+    do
+        { head -n 1 cache/C.optcache; echo "key $qty"; } > broken.optcache
+        cp broken.optcache cache/C.optcache
+        "$SOLC" c.sol --tvm-cache-dir cache >/dev/null
+        cmp c.code expected.code
+        if cmp -s cache/C.optcache broken.optcache; then exit 1; fi
+    done
+)
+rm -rf "$SOLTMPDIR"
+
+printTask "Testing remote imports..."
+SOLTMPDIR=$(mktemp -d)
+(
+    set -e
+    cd "$SOLTMPDIR"
+    mkdir mirror
+    echo 'pragma ton-solidity >= 0.35.0; contract A { uint a; }' > mirror/A.sol
+    echo 'pragma ton-solidity >= 0.35.0; contract B { uint b; }' > mirror/B.sol
+    echo 'pragma ton-solidity >= 0.35.0;
+import "https://example.com/x/A.sol";
+import "https://example.com/y/B.sol";
+contract C is A, B { function f() public pure {} }' > c.sol
+    "$SOLC" c.sol --tvm-remote-dir mirror >/dev/null
+    test -s c.code
+    cmp .solc_imports/A.sol mirror/A.sol
+    cmp .solc_imports/B.sol mirror/B.sol
+
+    echo 'pragma ton-solidity >= 0.35.0;
+import "https://example.com/x/Missing.sol";
+contract D {}' > d.sol
+    if output=$("$SOLC" d.sol --tvm-remote-dir mirror 2>&1); then exit 1; fi
+    [[ "$output" == *"Failed to fetch import file: \"https://example.com/x/Missing.sol"* ]]
+    test ! -e .solc_imports/Missing.sol
+)
+rm -rf "$SOLTMPDIR"
+
 printTask "Testing assemble, yul, strict-assembly and optimize..."
 (
     echo '{}' | "$SOLC" - --assemble &>/dev/null
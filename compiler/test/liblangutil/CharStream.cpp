@@ -47,6 +47,19 @@ BOOST_AUTO_TEST_CASE(test_fail)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(translate_position)
+{
+	CharStream const source("ab\ncd\n\nef", "source");
+
+	BOOST_CHECK(std::make_tuple(0, 0) == source.translatePositionToLineColumn(0));
+	BOOST_CHECK(std::make_tuple(0, 2) == source.translatePositionToLineColumn(2));
+	BOOST_CHECK(std::make_tuple(1, 0) == source.translatePositionToLineColumn(3));
+	BOOST_CHECK(std::make_tuple(2, 0) == source.translatePositionToLineColumn(6));
+	BOOST_CHECK(std::make_tuple(3, 1) == source.translatePositionToLineColumn(8));
+	BOOST_CHECK(std::make_tuple(3, 2) == source.translatePositionToLineColumn(100));
+	BOOST_CHECK_EQUAL(source.translatePositionToLine(4), 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
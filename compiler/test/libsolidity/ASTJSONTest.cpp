@@ -19,6 +19,7 @@
 #include <test/libsolidity/ASTJSONTest.h>
 #include <test/Common.h>
 #include <libsolutil/AnsiColorized.h>
+#include <libsolutil/JSON.h>
 #include <liblangutil/SourceReferenceFormatterHuman.h>
 #include <libsolidity/ast/ASTJsonConverter.h>
 #include <libsolidity/interface/CompilerStack.h>
@@ -210,6 +211,21 @@ TestCase::TestResult ASTJSONTest::run(ostream& _stream, string const& _linePrefi
 		resultsMatch = false;
 	}
 
+	// print streams the JSON, it has to match serialising the converted JSON exactly.
+	for (size_t i = 0; i < m_sources.size(); i++)
+		for (bool legacy: {false, true})
+		{
+			ostringstream result;
+			ASTJsonConverter(legacy, sourceIndices).print(result, c.ast(m_sources[i].first));
+			Json::Value json = ASTJsonConverter(legacy, sourceIndices).toJson(c.ast(m_sources[i].first));
+			if (result.str() != jsonPrettyPrint(json))
+			{
+				AnsiColorized(_stream, _formatted, {BOLD, RED}) << _linePrefix <<
+					"Printed AST differs from the serialised JSON AST" << (legacy ? " (legacy)." : ".") << endl;
+				resultsMatch = false;
+			}
+		}
+
 	return resultsMatch ? TestResult::Success : TestResult::Failure;
 }
 